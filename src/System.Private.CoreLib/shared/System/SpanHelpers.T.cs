@@ -3,6 +3,8 @@
 // See the LICENSE file in the project root for more information.
 
 using System.Diagnostics;
+using System.Numerics;
+using System.Runtime.CompilerServices;
 #if !NETSTANDARD2_0
 using Internal.Runtime.CompilerServices;
 #endif
@@ -213,6 +215,81 @@ namespace System
             return (int)(byte*)(index + 7);
         }
 
+        // Vectorized search for primitive element types that can be compared bitwise. The
+        // callers are expected to have reinterpreted the span as one of the supported element
+        // types (int or long) after checking RuntimeHelpers.IsBitwiseEquatable<T>().
+        public static int IndexOfValueType<T>(ref T searchSpace, T value, int length)
+            where T : struct, IEquatable<T>
+        {
+            Debug.Assert(length >= 0);
+            Debug.Assert(typeof(T) == typeof(int) || typeof(T) == typeof(long));
+
+            int offset = 0;
+
+            if (Vector.IsHardwareAccelerated && length >= Vector<T>.Count)
+            {
+                Vector<T> values = new Vector<T>(value);
+                int lastVectorOffset = length - Vector<T>.Count;
+
+                do
+                {
+                    Vector<T> matches = Vector.Equals(values, LoadVector(ref searchSpace, offset));
+                    if (!Vector<T>.Zero.Equals(matches))
+                    {
+                        return offset + LocateFirstFoundElement(matches);
+                    }
+
+                    offset += Vector<T>.Count;
+                }
+                while (offset <= lastVectorOffset);
+            }
+
+            // Scalar search of the remaining elements.
+            for (; offset < length; offset++)
+            {
+                if (value.Equals(Unsafe.Add(ref searchSpace, offset)))
+                {
+                    return offset;
+                }
+            }
+
+            return -1;
+        }
+
+        public static bool ContainsValueType<T>(ref T searchSpace, T value, int length)
+            where T : struct, IEquatable<T>
+        {
+            return IndexOfValueType(ref searchSpace, value, length) >= 0;
+        }
+
+        [MethodImpl(MethodImplOptions.AggressiveInlining)]
+        private static Vector<T> LoadVector<T>(ref T start, int offset)
+            where T : struct
+            => Unsafe.ReadUnaligned<Vector<T>>(ref Unsafe.As<T, byte>(ref Unsafe.Add(ref start, offset)));
+
+        [MethodImpl(MethodImplOptions.AggressiveInlining)]
+        private static int LocateFirstFoundElement<T>(Vector<T> match)
+            where T : struct
+        {
+            // Each element of a comparison result is either all zero or all one bits, so the
+            // first non-zero ulong locates the first match at element granularity.
+            var vector64 = Vector.AsVectorUInt64(match);
+            ulong candidate = 0;
+            int i = 0;
+            for (; i < Vector<ulong>.Count; i++)
+            {
+                candidate = vector64[i];
+                if (candidate != 0)
+                {
+                    break;
+                }
+            }
+
+            int elementsPerUInt64 = sizeof(ulong) / Unsafe.SizeOf<T>();
+            int elementInUInt64 = ((candidate & 0xFFFFFFFF) == 0 && elementsPerUInt64 > 1) ? 1 : 0;
+            return i * elementsPerUInt64 + elementInUInt64;
+        }
+
         public static int IndexOfAny<T>(ref T searchSpace, T value0, T value1, int length)
 #nullable disable // to enable use with both T and T? for reference types due to IEquatable<T> being invariant
             where T : IEquatable<T>
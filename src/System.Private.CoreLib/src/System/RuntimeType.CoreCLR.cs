@@ -3328,6 +3328,12 @@ namespace System
         internal object? CheckValue(object? value, Binder? binder, CultureInfo? culture, BindingFlags invokeAttr)
         {
             // this method is used by invocation in reflection to check whether a value can be assigned to type.
+
+            // Fast path for the common case of an argument whose type exactly matches the parameter type,
+            // which needs neither the cast check nor re-boxing below.
+            if (value != null && ReferenceEquals(value.GetType(), this))
+                return value;
+
             if (IsInstanceOfType(value))
             {
                 // Since this cannot be a generic parameter, we use RuntimeTypeHandle.IsValueType here
@@ -80,6 +80,12 @@ void CommandLine::DumpHelp(const char* program)
     printf("         t - method throughput time\n");
     printf("         * - all available method stats\n");
     printf("\n");
+    printf(" -throughputIterations <count>\n");
+    printf("     Number of times each method is recompiled when measuring throughput with\n");
+    printf("     '-emitMethodStats t'. The two fastest compiles are kept to reduce noise.\n");
+    printf("     A summary of the total cycles spent in each JIT is reported at the end.\n");
+    printf("     Default: 10.\n");
+    printf("\n");
     printf(" -a[pplyDiff]\n");
     printf("     Compare the compile result generated from the provided JIT with the\n");
     printf("     compile result stored with the MC. If two JITs are provided, this\n");
@@ -365,6 +371,23 @@ bool CommandLine::Parse(int argc, char* argv[], /* OUT */ Options* o)
 
                 o->methodStatsTypes = argv[i];
             }
+            else if ((_strnicmp(&argv[i][1], "throughputIterations", argLen) == 0))
+            {
+                if (++i >= argc)
+                {
+                    DumpHelp(argv[0]);
+                    return false;
+                }
+
+                o->throughputIterations = atoi(argv[i]);
+
+                if (o->throughputIterations < 1)
+                {
+                    LogError("Invalid throughput iteration count specified, count must be at least 1.");
+                    DumpHelp(argv[0]);
+                    return false;
+                }
+            }
             else if ((_strnicmp(&argv[i][1], "applyDiff", argLen) == 0))
             {
                 o->applyDiff = true;
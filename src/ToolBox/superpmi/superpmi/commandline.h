@@ -42,6 +42,7 @@ public:
             , compileList(nullptr)
             , offset(-1)
             , increment(-1)
+            , throughputIterations(10)
             , forceJitOptions(nullptr)
             , forceJit2Options(nullptr)
             , jitOptions(nullptr)
@@ -71,6 +72,7 @@ public:
         char* compileList;
         int   offset;
         int   increment;
+        int   throughputIterations; // Number of timed compiles per method when collecting throughput.
         LightWeightMap<DWORD, DWORD>* forceJitOptions;
         LightWeightMap<DWORD, DWORD>* forceJit2Options;
         LightWeightMap<DWORD, DWORD>* jitOptions;
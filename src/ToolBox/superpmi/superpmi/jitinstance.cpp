@@ -275,7 +275,10 @@ bool JitInstance::reLoad(MethodContext* firstContext)
     return true;
 }
 
-JitInstance::Result JitInstance::CompileMethod(MethodContext* MethodToCompile, int mcIndex, bool collectThroughput)
+JitInstance::Result JitInstance::CompileMethod(MethodContext* MethodToCompile,
+                                               int            mcIndex,
+                                               bool           collectThroughput,
+                                               int            throughputIterations)
 {
     struct Param : FilterSuperPMIExceptionsParam_CaptureException
     {
@@ -370,7 +373,7 @@ JitInstance::Result JitInstance::CompileMethod(MethodContext* MethodToCompile, i
     if (collectThroughput)
     {
         // If we get here, we know it compiles
-        timeResult(param.info, param.flags);
+        timeResult(param.info, param.flags, throughputIterations);
     }
 
     mc->cr->secondsToCompile = stj.GetSeconds();
@@ -378,12 +381,11 @@ JitInstance::Result JitInstance::CompileMethod(MethodContext* MethodToCompile, i
     return param.result;
 }
 
-void JitInstance::timeResult(CORINFO_METHOD_INFO info, unsigned flags)
+void JitInstance::timeResult(CORINFO_METHOD_INFO info, unsigned flags, int sampleSize)
 {
     BYTE* NEntryBlock    = nullptr;
     ULONG NCodeSizeBlock = 0;
 
-    int sampleSize = 10;
     // Save 2 smallest times. To help reduce noise, we will look at the closest pair of these.
     unsigned __int64 time;
 
@@ -31,7 +31,7 @@ private:
     MethodContext::Environment environment;
 
     JitInstance(){};
-    void timeResult(CORINFO_METHOD_INFO info, unsigned flags);
+    void timeResult(CORINFO_METHOD_INFO info, unsigned flags, int sampleSize);
 
 public:
     enum Result
@@ -60,7 +60,10 @@ public:
 
     bool resetConfig(MethodContext* firstContext);
 
-    Result CompileMethod(MethodContext* MethodToCompile, int mcIndex, bool collectThroughput);
+    Result CompileMethod(MethodContext* MethodToCompile,
+                         int            mcIndex,
+                         bool           collectThroughput,
+                         int            throughputIterations);
 
     const WCHAR* getForceOption(const WCHAR* key);
     const WCHAR* getOption(const WCHAR* key);
@@ -197,6 +197,9 @@ void ProcessChildStdOut(const CommandLine::Options& o,
                         int*                        failed,
                         int*                        excluded,
                         int*                        diffs,
+                        ULONGLONG*                  cycles1,
+                        ULONGLONG*                  cycles2,
+                        bool*                       sawThroughput,
                         bool*                       usageError)
 {
     char buff[MAX_LOG_LINE_SIZE];
@@ -268,6 +271,23 @@ void ProcessChildStdOut(const CommandLine::Options& o,
             *failed += childFailed;
             *excluded += childExcluded;
         }
+        else if (strncmp(buff, g_ThroughputFormatStringFixedPrefix, strlen(g_ThroughputFormatStringFixedPrefix)) == 0)
+        {
+            ULONGLONG childCycles = 0;
+            if (sscanf_s(buff, g_Jit1ThroughputFormatString, &childCycles) == 1)
+            {
+                *cycles1 += childCycles;
+                *sawThroughput = true;
+            }
+            else if (sscanf_s(buff, g_Jit2ThroughputFormatString, &childCycles) == 1)
+            {
+                *cycles2 += childCycles;
+            }
+            else
+            {
+                LogError("Couldn't parse throughput message: \"%s\"", buff);
+            }
+        }
     }
 
 Cleanup:
@@ -382,6 +402,8 @@ char* ConstructChildProcessArgs(const CommandLine::Options& o)
     ADDARG_STRING(o.reproName, "-reproName");
     ADDARG_STRING(o.writeLogFile, "-writeLogFile");
     ADDARG_STRING(o.methodStatsTypes, "-emitMethodStats");
+    bytesWritten += sprintf_s(spmiArgs + bytesWritten, MAX_CMDLINE_SIZE - bytesWritten, " -throughputIterations %d",
+                              o.throughputIterations);
     ADDARG_STRING(o.reproName, "-reproName");
     ADDARG_STRING(o.hash, "-matchHash");
     ADDARG_STRING(o.targetArchitecture, "-target");
@@ -605,12 +627,17 @@ int doParallelSuperPMI(CommandLine::Options& o)
 
         int loaded = 0, jitted = 0, failed = 0, excluded = 0, diffs = 0;
 
+        // Compile cycles summed across all children, if they measured throughput.
+        ULONGLONG cycles1 = 0, cycles2 = 0;
+        bool      sawThroughput = false;
+
         // Read the stderr files and log them as errors
         // Read the stdout files and parse them for counts and log any MISSING or ISSUE errors
         for (int i = 0; i < o.workerCount; i++)
         {
             ProcessChildStdErr(arrStdErrorPath[i]);
-            ProcessChildStdOut(o, arrStdOutputPath[i], &loaded, &jitted, &failed, &excluded, &diffs, &usageError);
+            ProcessChildStdOut(o, arrStdOutputPath[i], &loaded, &jitted, &failed, &excluded, &diffs, &cycles1, &cycles2,
+                               &sawThroughput, &usageError);
             if (usageError)
                 break;
         }
@@ -637,6 +664,11 @@ int doParallelSuperPMI(CommandLine::Options& o)
             {
                 LogInfo(g_SummaryFormatString, loaded, jitted, failed, excluded);
             }
+
+            if (sawThroughput)
+            {
+                LogThroughputSummary(cycles1, cycles2, o.nameOfJit2 != nullptr);
+            }
         }
 
         st.Stop();
@@ -29,6 +29,23 @@ const char* const g_AllFormatStringFixedPrefix  = "Loaded ";
 const char* const g_SummaryFormatString         = "Loaded %d  Jitted %d  FailedCompile %d Excluded %d";
 const char* const g_AsmDiffsSummaryFormatString = "Loaded %d  Jitted %d  FailedCompile %d Excluded %d Diffs %d";
 
+// Throughput summaries (with '-emitMethodStats t') are also parsed by ProcessChildStdOut(), so that -parallel
+// can add up the cycles of all of its children. They share their own fixed prefix; the JIT2 line may be followed
+// by the percentage change, which is recomputed from the totals rather than parsed.
+const char* const g_ThroughputFormatStringFixedPrefix = "Throughput: ";
+const char* const g_Jit1ThroughputFormatString        = "Throughput: JIT1 %llu cycles";
+const char* const g_Jit2ThroughputFormatString        = "Throughput: JIT2 %llu cycles";
+
+void LogThroughputSummary(ULONGLONG totalCycles1, ULONGLONG totalCycles2, bool haveJit2)
+{
+    LogInfo(g_Jit1ThroughputFormatString, totalCycles1);
+    if (haveJit2 && (totalCycles1 != 0))
+    {
+        LogInfo("Throughput: JIT2 %llu cycles (%+.2f%%)", totalCycles2,
+                100.0 * ((double)totalCycles2 - (double)totalCycles1) / (double)totalCycles1);
+    }
+}
+
 //#define SuperPMI_ChewMemory 0x7FFFFFFF //Amount of address space to consume on startup
 
 SPMI_TARGET_ARCHITECTURE SpmiTargetArchitecture;
@@ -251,6 +268,10 @@ int __cdecl main(int argc, char* argv[])
     int index             = 0;
     int excludedCount     = 0;
 
+    // Total compile cycles across all methods, used to summarize throughput.
+    ULONGLONG totalCycles1 = 0;
+    ULONGLONG totalCycles2 = 0;
+
     st1.Start();
     NearDiffer nearDiffer(o.targetArchitecture, o.useCoreDisTools);
 
@@ -357,7 +378,7 @@ int __cdecl main(int argc, char* argv[])
 
         jittedCount++;
         st3.Start();
-        res = jit->CompileMethod(mc, reader->GetMethodContextIndex(), collectThroughput);
+        res = jit->CompileMethod(mc, reader->GetMethodContextIndex(), collectThroughput, o.throughputIterations);
         st3.Stop();
         LogDebug("Method %d compiled in %fms, result %d", reader->GetMethodContextIndex(), st3.GetMilliseconds(), res);
 
@@ -375,7 +396,7 @@ int __cdecl main(int argc, char* argv[])
             mc->cr = new CompileResult();
 
             st4.Start();
-            res2 = jit2->CompileMethod(mc, reader->GetMethodContextIndex(), collectThroughput);
+            res2 = jit2->CompileMethod(mc, reader->GetMethodContextIndex(), collectThroughput, o.throughputIterations);
             st4.Stop();
             LogDebug("Method %d compiled by JIT2 in %fms, result %d", reader->GetMethodContextIndex(),
                      st4.GetMilliseconds(), res2);
@@ -473,6 +494,9 @@ int __cdecl main(int argc, char* argv[])
                         }
                     }
 
+                    totalCycles1 += crl->clockCyclesToCompile;
+                    totalCycles2 += mc->cr->clockCyclesToCompile;
+
                     if (methodStatsEmitter != nullptr)
                     {
                         methodStatsEmitter->Emit(reader->GetMethodContextIndex(), mc, crl->clockCyclesToCompile,
@@ -485,6 +509,13 @@ int __cdecl main(int argc, char* argv[])
                         mc->cr->clockCyclesToCompile = jit->times[1];
                     else
                         mc->cr->clockCyclesToCompile = jit->times[0];
+
+                    // When JIT2 failed on this method there is nothing to compare against, so leave it out of
+                    // the totals rather than charging JIT1 alone for it and overstating the JIT2 delta.
+                    if (o.nameOfJit2 == nullptr)
+                    {
+                        totalCycles1 += mc->cr->clockCyclesToCompile;
+                    }
                     if (methodStatsEmitter != nullptr)
                     {
                         methodStatsEmitter->Emit(reader->GetMethodContextIndex(), mc, mc->cr->clockCyclesToCompile, 0);
@@ -582,6 +613,11 @@ int __cdecl main(int argc, char* argv[])
         LogInfo(g_SummaryFormatString, loadedCount, jittedCount, failToReplayCount, excludedCount);
     }
 
+    if (collectThroughput)
+    {
+        LogThroughputSummary(totalCycles1, totalCycles2, o.nameOfJit2 != nullptr);
+    }
+
     st2.Stop();
     LogVerbose("Total time: %fms", st2.GetMilliseconds());
 
@@ -24,6 +24,11 @@ extern const char* const g_SuperPMIUsageFirstLine;
 extern const char* const g_AllFormatStringFixedPrefix;
 extern const char* const g_SummaryFormatString;
 extern const char* const g_AsmDiffsSummaryFormatString;
+extern const char* const g_ThroughputFormatStringFixedPrefix;
+extern const char* const g_Jit1ThroughputFormatString;
+extern const char* const g_Jit2ThroughputFormatString;
+
+extern void LogThroughputSummary(ULONGLONG totalCycles1, ULONGLONG totalCycles2, bool haveJit2);
 
 enum class SpmiResult
 {
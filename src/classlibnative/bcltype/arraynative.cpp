@@ -1084,6 +1084,40 @@ FCIMPL2(void, ArrayNative::SetValue, TypedByRef * target, Object* objUNSAFE)
 }
 FCIMPLEND
 
+// Copy the data of an RVA field into the elements of a primitive array, fixing up the byte order of each
+// element on big-endian platforms.
+static void CopyArrayInitializationData(void *dest, const void *src, SIZE_T dwCompSize, SIZE_T dwElemCnt)
+{
+    LIMITED_METHOD_CONTRACT;
+
+#if BIGENDIAN
+    DWORD i;
+    switch (dwCompSize) {
+    case 1:
+        memcpyNoGCRefs(dest, src, dwElemCnt);
+        break;
+    case 2:
+        for (i = 0; i < dwElemCnt; i++)
+            *((UINT16*)dest + i) = GET_UNALIGNED_VAL16((UINT16*)src + i);
+        break;
+    case 4:
+        for (i = 0; i < dwElemCnt; i++)
+            *((UINT32*)dest + i) = GET_UNALIGNED_VAL32((UINT32*)src + i);
+        break;
+    case 8:
+        for (i = 0; i < dwElemCnt; i++)
+            *((UINT64*)dest + i) = GET_UNALIGNED_VAL64((UINT64*)src + i);
+        break;
+    default:
+        // should not reach here.
+        UNREACHABLE_MSG("Incorrect primitive type size!");
+        break;
+    }
+#else
+    memcpyNoGCRefs(dest, src, dwCompSize * dwElemCnt);
+#endif
+}
+
 // This method will initialize an array from a TypeHandle to a field.
 
 FCIMPL2_IV(void, ArrayNative::InitializeArray, ArrayBase* pArrayRef, FCALLRuntimeFieldHandle structField)
@@ -1092,6 +1126,34 @@ FCIMPL2_IV(void, ArrayNative::InitializeArray, ArrayBase* pArrayRef, FCALLRuntim
 
     BASEARRAYREF arr = BASEARRAYREF(pArrayRef);
     REFLECTFIELDREF refField = (REFLECTFIELDREF)ObjectToOBJECTREF(FCALL_RFH_TO_REFLECTFIELD(structField));
+
+    // Static constructors building constant tables end up here whenever the JIT didn't expand the copy
+    // inline (minopts and tier0 code, or an RVA field that lives in another ReadyToRun image), so do the
+    // common case without erecting a frame. The RVA field is typically typed as a value type of the right
+    // size; GetSize won't load that type, so if it isn't loaded yet take the framed path, which will.
+    if ((arr != NULL) && (refField != NULL))
+    {
+        FieldDesc* pField = (FieldDesc*) refField->GetField();
+
+        if (pField->IsRVA() &&
+            (CorTypeInfo::IsPrimitiveType(arr->GetArrayElementType()) || arr->GetArrayElementTypeHandle().IsEnum()))
+        {
+            SIZE_T dwCompSize = arr->GetComponentSize();
+            SIZE_T dwElemCnt = arr->GetNumComponents();
+            UINT size = pField->GetSize();
+
+            if ((size != (UINT)-1) && (dwCompSize * dwElemCnt <= size))
+            {
+                g_IBCLogger.LogRVADataAccess(pField);
+
+                CopyArrayInitializationData(arr->GetDataPtr(), pField->GetStaticAddressHandle(NULL), dwCompSize, dwElemCnt);
+
+                FC_GC_POLL();
+                return;
+            }
+        }
+    }
+
     HELPER_METHOD_FRAME_BEGIN_2(arr, refField);
 
     if ((arr == 0) || (refField == NULL))
@@ -1126,32 +1188,7 @@ FCIMPL2_IV(void, ArrayNative::InitializeArray, ArrayBase* pArrayRef, FCALLRuntim
     void *src = pField->GetStaticAddressHandle(NULL);
     void *dest = arr->GetDataPtr();
 
-#if BIGENDIAN
-    DWORD i;
-    switch (dwCompSize) {
-    case 1:
-        memcpyNoGCRefs(dest, src, dwElemCnt);
-        break;
-    case 2:
-        for (i = 0; i < dwElemCnt; i++)
-            *((UINT16*)dest + i) = GET_UNALIGNED_VAL16((UINT16*)src + i);
-        break;
-    case 4:
-        for (i = 0; i < dwElemCnt; i++)
-            *((UINT32*)dest + i) = GET_UNALIGNED_VAL32((UINT32*)src + i);
-        break;
-    case 8:
-        for (i = 0; i < dwElemCnt; i++)
-            *((UINT64*)dest + i) = GET_UNALIGNED_VAL64((UINT64*)src + i);
-        break;
-    default:
-        // should not reach here.
-        UNREACHABLE_MSG("Incorrect primitive type size!");
-        break;
-    }
-#else
-    memcpyNoGCRefs(dest, src, dwTotalSize);
-#endif
+    CopyArrayInitializationData(dest, src, dwCompSize, dwElemCnt);
 
     HELPER_METHOD_FRAME_END();
 }
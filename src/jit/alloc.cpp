@@ -83,8 +83,25 @@ void* ArenaAllocator::allocateNewPage(size_t size)
 
     if (!bypassHostAllocator())
     {
-        // Round to the nearest multiple of default page size
-        pageSize = roundUp(pageSize, DEFAULT_PAGE_SIZE);
+        if (pageSize <= MAX_SIZE_CLASS_PAGE_SIZE)
+        {
+            // Round up to a power of two multiple of the default page size. The host
+            // caches freed slabs and only hands them out again for requests of a similar
+            // size, so keeping oversized pages to a few size classes lets pages freed by
+            // one compilation be reused by the next. The extra space is not wasted: later
+            // allocations are carved out of the remainder of the page.
+            size_t classSize = DEFAULT_PAGE_SIZE;
+            while (classSize < pageSize)
+            {
+                classSize *= 2;
+            }
+            pageSize = classSize;
+        }
+        else
+        {
+            // Round to the nearest multiple of default page size
+            pageSize = roundUp(pageSize, DEFAULT_PAGE_SIZE);
+        }
     }
 
     // Allocate the new page
@@ -41,6 +41,10 @@ private:
     enum
     {
         DEFAULT_PAGE_SIZE = 0x10000,
+
+        // Pages up to this size are rounded up to a power of two multiple of
+        // DEFAULT_PAGE_SIZE so that the host's slab cache can recycle them.
+        MAX_SIZE_CLASS_PAGE_SIZE = 0x80000,
     };
 
     PageDescriptor* m_firstPage;
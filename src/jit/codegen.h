@@ -1028,6 +1028,7 @@ protected:
     // Do liveness update for register produced by the current node in codegen after
     // code has been emitted for it.
     void genProduceReg(GenTree* tree);
+    bool genIsRematerializableSpill(GenTree* tree);
     void genUnspillRegIfNeeded(GenTree* tree);
     regNumber genConsumeReg(GenTree* tree);
     void genCopyRegIfNeeded(GenTree* tree, regNumber needReg);
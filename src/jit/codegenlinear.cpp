@@ -916,6 +916,27 @@ GenTree* sameRegAsDst(GenTree* tree, GenTree*& other /*out*/)
     }
 }
 
+//------------------------------------------------------------------------
+// genIsRematerializableSpill: Check whether a spilled tree temp can be regenerated
+//    at its use rather than stored to and reloaded from a spill temp.
+//
+// Arguments:
+//    tree - the node of interest.
+//
+// Return Value:
+//    True if 'tree' is a constant that can be rematerialized, and its use is not
+//    going to read it directly from the spill temp.
+//
+bool CodeGen::genIsRematerializableSpill(GenTree* tree)
+{
+    if (!tree->IsCnsIntOrI() || ((tree->gtFlags & GTF_NOREG_AT_USE) != 0))
+    {
+        return false;
+    }
+
+    return tree->AsIntConCommon()->ImmedValCanBeRematerialized(compiler);
+}
+
 //------------------------------------------------------------------------
 // genUnspillRegIfNeeded: Reload the value into a register, if needed
 //
@@ -1155,6 +1176,16 @@ void CodeGen::genUnspillRegIfNeeded(GenTree* tree)
         }
 #endif //_TARGET_ARM_
 #endif // FEATURE_ARG_SPLIT
+        else if (genIsRematerializableSpill(unspillTree))
+        {
+            // The constant was not stored to a spill temp when it was defined (see genProduceReg),
+            // so rematerialize it in the target register instead of reloading it.
+            instGen_Set_Reg_To_Imm(emitActualTypeSize(unspillTree->TypeGet()), dstReg,
+                                   unspillTree->AsIntConCommon()->IconValue(), INS_FLAGS_NOT_SET);
+
+            unspillTree->gtFlags &= ~GTF_SPILLED;
+            gcInfo.gcMarkRegPtrVal(dstReg, unspillTree->TypeGet());
+        }
         else
         {
             TempDsc* t = regSet.rsUnspillInPlace(unspillTree, unspillTree->GetRegNum());
@@ -1914,6 +1945,12 @@ void CodeGen::genProduceReg(GenTree* tree)
             }
 #endif // _TARGET_ARM_
 #endif // FEATURE_ARG_SPLIT
+            else if (genIsRematerializableSpill(tree))
+            {
+                // The constant will be regenerated at its use (see genUnspillRegIfNeeded),
+                // so there is no need to store it to a spill temp.
+                gcInfo.gcMarkRegSetNpt(genRegMask(tree->GetRegNum()));
+            }
             else
             {
                 regSet.rsSpillTree(tree->GetRegNum(), tree);
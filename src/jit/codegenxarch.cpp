@@ -2949,10 +2949,10 @@ void CodeGen::genCodeForInitBlkUnroll(GenTreeBlk* node)
     }
     else
     {
-        // If src is contained then it must be 0 and the size must be a multiple
-        // of XMM_REGSIZE_BYTES so initialization can use only SSE2 instructions.
+        // If src is contained then it must be 0 and the size must be at least
+        // XMM_REGSIZE_BYTES so initialization can use only SSE2 instructions.
         assert(src->IsIntegralConst(0));
-        assert((node->GetLayout()->GetSize() % XMM_REGSIZE_BYTES) == 0);
+        assert(node->GetLayout()->GetSize() >= XMM_REGSIZE_BYTES);
     }
 
     emitter* emit = GetEmitter();
@@ -2984,9 +2984,14 @@ void CodeGen::genCodeForInitBlkUnroll(GenTreeBlk* node)
             emit->emitIns_AR_R(INS_movdqu, EA_ATTR(regSize), srcXmmReg, dstAddrBaseReg, dstOffset);
         }
 
-        // TODO-CQ-XArch: On x86 we could initialize 8 byte at once by using MOVQ instead of two 4 byte MOV stores.
-        // On x64 it may also be worth zero initializing a 4/8 byte remainder using MOVD/MOVQ, that avoids the need
-        // to allocate a GPR just for the remainder.
+        // Fill the remainder with one more SSE2 store that overlaps the previous one,
+        // that's cheaper than a sequence of smaller stores and doesn't need a GPR.
+        if (size > 0)
+        {
+            dstOffset -= XMM_REGSIZE_BYTES - size;
+            emit->emitIns_AR_R(INS_movdqu, EA_16BYTE, srcXmmReg, dstAddrBaseReg, dstOffset);
+            size = 0;
+        }
     }
 
     // Fill the remainder using normal stores.
@@ -3129,9 +3134,33 @@ void CodeGen::genCodeForCpBlkUnroll(GenTreeBlk* node)
             }
         }
 
-        // TODO-CQ-XArch: On x86 we could copy 8 byte at once by using MOVQ instead of four 4 byte MOV stores.
-        // On x64 it may also be worth copying a 4/8 byte remainder using MOVD/MOVQ, that avoids the need to
-        // allocate a GPR just for the remainder.
+        // Copy the remainder with one more SSE2 load/store pair that overlaps the previous
+        // one, that's cheaper than a sequence of smaller moves and doesn't need a GPR.
+        if (size > 0)
+        {
+            srcOffset -= XMM_REGSIZE_BYTES - size;
+            dstOffset -= XMM_REGSIZE_BYTES - size;
+
+            if (srcLclNum != BAD_VAR_NUM)
+            {
+                emit->emitIns_R_S(INS_movdqu, EA_16BYTE, tempReg, srcLclNum, srcOffset);
+            }
+            else
+            {
+                emit->emitIns_R_AR(INS_movdqu, EA_16BYTE, tempReg, srcAddrBaseReg, srcOffset);
+            }
+
+            if (dstLclNum != BAD_VAR_NUM)
+            {
+                emit->emitIns_S_R(INS_movdqu, EA_16BYTE, tempReg, dstLclNum, dstOffset);
+            }
+            else
+            {
+                emit->emitIns_AR_R(INS_movdqu, EA_16BYTE, tempReg, dstAddrBaseReg, dstOffset);
+            }
+
+            size = 0;
+        }
     }
 
     if (size > 0)
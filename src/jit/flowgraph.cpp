@@ -11748,6 +11748,30 @@ bool Compiler::fgExpandRarelyRunBlocks()
                 }
                 break;
 
+            case BBJ_SWITCH:
+            {
+                /* Are all of the switch targets rarely run? */
+                unsigned     jumpCnt = bPrev->bbJumpSwt->bbsCount;
+                BasicBlock** jumpTab = bPrev->bbJumpSwt->bbsDstTab;
+                bool         allRare = true;
+
+                do
+                {
+                    if (!(*jumpTab)->isRunRarely())
+                    {
+                        allRare = false;
+                        break;
+                    }
+                } while (++jumpTab, --jumpCnt);
+
+                if (allRare)
+                {
+                    INDEBUG(reason = "All targets of a switch are rarely run";)
+                    goto NEW_RARELY_RUN;
+                }
+                break;
+            }
+
             case BBJ_COND:
 
                 if (!block->isRunRarely())
@@ -25731,8 +25755,9 @@ bool Compiler::fgUseThrowHelperBlocks()
 //    that can be merged, and opportunistically merges them.
 //
 //    Does not handle throws yet as the analysis is more costly and less
-//    likely to pay off. So analysis is restricted to blocks with just one
-//    statement.
+//    likely to pay off. So analysis is restricted to blocks with a few
+//    statements that end in a noreturn call; blocks only match if all
+//    their statements are identical.
 //
 //    For throw helper call merging, we are looking for examples like
 //    the below. Here BB17 and BB21 have identical trees that call noreturn
@@ -25796,7 +25821,24 @@ void Compiler::fgTailMergeThrows()
 
         static bool Equals(const ThrowHelper x, const ThrowHelper& y)
         {
-            return BasicBlock::sameEHRegion(x.m_block, y.m_block) && GenTreeCall::Equals(x.m_call, y.m_call);
+            if (!BasicBlock::sameEHRegion(x.m_block, y.m_block) || !GenTreeCall::Equals(x.m_call, y.m_call))
+            {
+                return false;
+            }
+
+            // Any statements leading up to the calls must match as well.
+            Statement* xStmt = x.m_block->firstStmt();
+            Statement* yStmt = y.m_block->firstStmt();
+
+            for (; (xStmt != nullptr) && (yStmt != nullptr); xStmt = xStmt->GetNextStmt(), yStmt = yStmt->GetNextStmt())
+            {
+                if (!GenTree::Compare(xStmt->GetRootNode(), yStmt->GetRootNode()))
+                {
+                    return false;
+                }
+            }
+
+            return (xStmt == nullptr) && (yStmt == nullptr);
         }
 
         static unsigned GetHashCode(const ThrowHelper& x)
@@ -25831,18 +25873,75 @@ void Compiler::fgTailMergeThrows()
     // Walk blocks from last to first so that any branches we
     // introduce to the canonical blocks end up lexically forward
     // and there is less jumbled flow to sort out later.
+    //
+    // Blocks with more than a few statements are unlikely to match and
+    // are costly to compare, so they are not considered.
+    const unsigned maxStmtCount = 4;
+
     for (BasicBlock* block = fgLastBB; block != nullptr; block = block->bbPrev)
     {
-        // For throw helpers the block should have exactly one statement....
+        // For throw helpers the block should have just a few statements....
         // (this isn't guaranteed, but seems likely)
-        Statement* stmt = block->firstStmt();
+        Statement* const firstStmt = block->firstStmt();
+
+        if (firstStmt == nullptr)
+        {
+            continue;
+        }
+
+        unsigned   stmtCount = 1;
+        Statement* stmt      = firstStmt;
+
+        while ((stmt->GetNextStmt() != nullptr) && (stmtCount < maxStmtCount))
+        {
+            stmt = stmt->GetNextStmt();
+            stmtCount++;
+        }
+
+        if (stmt->GetNextStmt() != nullptr)
+        {
+            continue;
+        }
+
+        // ...whose leading statements have no calls, volatile accesses or ordering
+        // side effects. Those are matched with GenTree::Compare, which ignores
+        // these, so merging such statements could change behavior.
+        bool hasUnmergeableStmt = false;
+
+        for (Statement* leadingStmt = firstStmt; leadingStmt != stmt; leadingStmt = leadingStmt->GetNextStmt())
+        {
+            fgWalkResult result =
+                fgWalkTreePre(leadingStmt->GetRootNodePointer(),
+                              [](GenTree** slot, fgWalkData* data) -> Compiler::fgWalkResult {
+                                  GenTree* const node = *slot;
+
+                                  if ((node->gtFlags & (GTF_CALL | GTF_ORDER_SIDEEFF)) != 0)
+                                  {
+                                      return Compiler::WALK_ABORT;
+                                  }
+
+                                  if ((node->OperIsIndir() || node->OperIs(GT_FIELD)) &&
+                                      ((node->gtFlags & GTF_IND_VOLATILE) != 0))
+                                  {
+                                      return Compiler::WALK_ABORT;
+                                  }
+
+                                  return Compiler::WALK_CONTINUE;
+                              });
+
+            if (result == WALK_ABORT)
+            {
+                hasUnmergeableStmt = true;
+                break;
+            }
+        }
 
-        if ((stmt == nullptr) || (stmt->GetNextStmt() != nullptr))
+        if (hasUnmergeableStmt)
         {
             continue;
         }
 
-        // ...that is a call
+        // ...the last of which is a call
         GenTree* const tree = stmt->GetRootNode();
 
         if (!tree->IsCall())
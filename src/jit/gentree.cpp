@@ -7210,7 +7210,10 @@ GenTree* Compiler::gtCloneExpr(
         {
             /* These nodes sometimes get bashed to "fat" ones */
 
+#ifndef _TARGET_64BIT_
+            // Multiplication only becomes a helper call on 32-bit targets.
             case GT_MUL:
+#endif
             case GT_DIV:
             case GT_MOD:
 
@@ -12247,7 +12250,9 @@ GenTree* Compiler::gtCreateHandleCompare(genTreeOps             oper,
 //        typeof(...) == typeof(...)
 //
 //    And potentially optimizes away the need to obtain actual
-//    RuntimeType objects to do the comparison.
+//    RuntimeType objects to do the comparison. When the object's
+//    exact type is known and it is not null, the comparison may be
+//    resolved to a constant.
 
 GenTree* Compiler::gtFoldTypeCompare(GenTree* tree)
 {
@@ -12392,8 +12397,9 @@ GenTree* Compiler::gtFoldTypeCompare(GenTree* tree)
     GenTree* const opOther  = op1IsFromHandle ? op2 : op1;
 
     // Tunnel through the handle operand to get at the class handle involved.
-    GenTree* const       opHandleArgument = opHandle->AsCall()->gtCallArgs->GetNode();
-    CORINFO_CLASS_HANDLE clsHnd           = gtGetHelperArgClassHandle(opHandleArgument);
+    GenTree* const       opHandleArgument   = opHandle->AsCall()->gtCallArgs->GetNode();
+    unsigned             runtimeLookupCount = 0;
+    CORINFO_CLASS_HANDLE clsHnd             = gtGetHelperArgClassHandle(opHandleArgument, &runtimeLookupCount);
 
     // If we couldn't find the class handle, give up.
     if (clsHnd == NO_CLASS_HANDLE)
@@ -12401,6 +12407,57 @@ GenTree* Compiler::gtFoldTypeCompare(GenTree* tree)
         return tree;
     }
 
+    // Fetch the object whose type is being compared.
+    // Note we may see intrinsified or regular calls to GetType
+    GenTree* objOp = nullptr;
+
+    if (opOther->OperGet() == GT_INTRINSIC)
+    {
+        objOp = opOther->AsUnOp()->gtOp1;
+    }
+    else
+    {
+        objOp = opOther->AsCall()->gtCallThisArg->GetNode();
+    }
+
+    // If we know the exact type of a non-null object we may be able to
+    // resolve the comparison outright. This happens, for instance, for
+    // objects held in initialized static readonly fields.
+    bool                 objIsExact   = false;
+    bool                 objIsNonNull = false;
+    CORINFO_CLASS_HANDLE objClsHnd    = gtGetClassHandle(objOp, &objIsExact, &objIsNonNull);
+
+    if ((objClsHnd != NO_CLASS_HANDLE) && objIsExact && objIsNonNull)
+    {
+        JITDUMP("Asking runtime to compare exact object type %p (%s) and %p (%s) for equality\n", dspPtr(objClsHnd),
+                info.compCompHnd->getClassName(objClsHnd), dspPtr(clsHnd), info.compCompHnd->getClassName(clsHnd));
+        TypeCompareState s = info.compCompHnd->compareTypesForEquality(objClsHnd, clsHnd);
+
+        if (s != TypeCompareState::May)
+        {
+            const bool typesAreEqual = (s == TypeCompareState::Must);
+            const bool operatorIsEQ  = (oper == GT_EQ);
+            const int  compareResult = operatorIsEQ ^ typesAreEqual ? 0 : 1;
+            JITDUMP("Runtime reports comparison is known at jit time: %u\n", compareResult);
+            GenTree* result = gtNewIconNode(compareResult);
+
+            // Keep any side effects from computing the object.
+            GenTree* sideEffects = nullptr;
+            gtExtractSideEffList(objOp, &sideEffects);
+
+            if (sideEffects != nullptr)
+            {
+                result = gtNewOperNode(GT_COMMA, TYP_INT, sideEffects, result);
+            }
+
+            // Any runtime lookup that fed into this compare is
+            // now dead code, so it no longer requires the runtime context.
+            assert(lvaGenericsContextUseCount >= runtimeLookupCount);
+            lvaGenericsContextUseCount -= runtimeLookupCount;
+            return result;
+        }
+    }
+
     // Ask the VM if this type can be equality tested by a simple method
     // table comparison.
     CorInfoInlineTypeCheck typeCheckInliningResult =
@@ -12418,18 +12475,6 @@ GenTree* Compiler::gtFoldTypeCompare(GenTree* tree)
     GenTree* const knownMT = opHandleArgument;
 
     // Fetch object method table from the object itself.
-    GenTree* objOp = nullptr;
-
-    // Note we may see intrinsified or regular calls to GetType
-    if (opOther->OperGet() == GT_INTRINSIC)
-    {
-        objOp = opOther->AsUnOp()->gtOp1;
-    }
-    else
-    {
-        objOp = opOther->AsCall()->gtCallThisArg->GetNode();
-    }
-
     GenTree* const objMT = gtNewOperNode(GT_IND, TYP_I_IMPL, objOp);
 
     // Update various flags
@@ -16240,6 +16285,25 @@ bool GenTreeIntConCommon::ImmedValNeedsReloc(Compiler* comp)
     return comp->opts.compReloc && (gtOper == GT_CNS_INT) && IsIconHandle();
 }
 
+//------------------------------------------------------------------------
+// GenTreeIntConCommon::ImmedValCanBeRematerialized: can this immediate value be regenerated
+//    in a register at its use instead of being stored to, and reloaded from, a spill temp?
+//
+// Arguments:
+//    comp - Compiler instance
+//
+// Return Value:
+//    True if this is a non-GC integer constant that does not need a relocation; false otherwise.
+//
+// Notes:
+//    Zero is excluded because setting a register to zero may modify the flags on some targets,
+//    while a reload from a spill temp never does.
+
+bool GenTreeIntConCommon::ImmedValCanBeRematerialized(Compiler* comp)
+{
+    return (gtOper == GT_CNS_INT) && !varTypeIsGC(TypeGet()) && !ImmedValNeedsReloc(comp) && (IconValue() != 0);
+}
+
 //------------------------------------------------------------------------
 // ImmedValCanBeFolded: can this immediate value be folded for op?
 //
@@ -2816,6 +2816,7 @@ struct GenTreeIntConCommon : public GenTree
 
     bool ImmedValNeedsReloc(Compiler* comp);
     bool ImmedValCanBeFolded(Compiler* comp, genTreeOps op);
+    bool ImmedValCanBeRematerialized(Compiler* comp);
 
 #ifdef _TARGET_XARCH_
     bool FitsInAddrBase(Compiler* comp);
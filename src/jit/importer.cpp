@@ -12053,7 +12053,16 @@ void Compiler::impImportBlockCode(BasicBlock* block)
                 // pessimistically make all the nodes large enough to become
                 // call nodes.  Since call nodes aren't that much larger and
                 // these opcodes are infrequent enough I chose the latter.
+                // Multiplication is the exception on 64-bit targets: it is
+                // never morphed into a helper call there, and it is common
+                // enough that allocating it at its exact size is worthwhile.
+                CLANG_FORMAT_COMMENT_ANCHOR;
+
+#ifdef _TARGET_64BIT_
+                callNode = (oper != GT_MUL);
+#else
                 callNode = true;
+#endif
                 goto MATH_OP2_FLAGS;
 
             case CEE_AND:
@@ -18249,6 +18258,14 @@ void Compiler::impMakeDiscretionaryInlineObservations(InlineInfo* pInlineInfo, I
     {
         frequency = InlineCallsiteFrequency::LOOP;
     }
+    // Training data shows the call site runs at least twice per entry to the root
+    // method, so it is on a hot path even if no loop is visible from here.
+    else if (pInlineInfo->iciBlock->hasProfileWeight() && impInlineRoot()->fgFirstBB->hasProfileWeight() &&
+             (impInlineRoot()->fgFirstBB->bbWeight > BB_ZERO_WEIGHT) &&
+             ((pInlineInfo->iciBlock->bbWeight / 2) >= impInlineRoot()->fgFirstBB->bbWeight))
+    {
+        frequency = InlineCallsiteFrequency::HOT;
+    }
     else if (pInlineInfo->iciBlock->hasProfileWeight() && (pInlineInfo->iciBlock->bbWeight > BB_ZERO_WEIGHT))
     {
         frequency = InlineCallsiteFrequency::WARM;
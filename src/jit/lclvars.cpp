@@ -2035,9 +2035,29 @@ bool Compiler::StructPromotionHelper::TryPromoteStructField(lvaStructFieldInfo&
         return false;
     }
 
-    CorInfoType fieldCorType = compHandle->getFieldType(innerFieldHndl);
-    var_types   fieldVarType = JITtype2varType(fieldCorType);
-    unsigned    fieldSize    = genTypeSize(fieldVarType);
+    CORINFO_CLASS_HANDLE innerFieldTypeHnd = nullptr;
+    CorInfoType          fieldCorType      = compHandle->getFieldType(innerFieldHndl, &innerFieldTypeHnd);
+    var_types            fieldVarType      = JITtype2varType(fieldCorType);
+
+    if (fieldVarType == TYP_STRUCT)
+    {
+        // The wrapped field is itself a struct; see if it in turn wraps a single scalar so
+        // that nested wrappers like struct A { struct B { struct C { int x; } c; } b; } can be
+        // retyped down to the innermost primitive.
+        lvaStructFieldInfo innerFieldInfo;
+        innerFieldInfo.fldHnd     = innerFieldHndl;
+        innerFieldInfo.fldType    = TYP_STRUCT;
+        innerFieldInfo.fldTypeHnd = innerFieldTypeHnd;
+
+        if (!TryPromoteStructField(innerFieldInfo))
+        {
+            return false;
+        }
+
+        fieldVarType = innerFieldInfo.fldType;
+    }
+
+    unsigned fieldSize = genTypeSize(fieldVarType);
 
     // Do not promote if the field is not a primitive type, is floating-point,
     // or is not properly aligned.
@@ -2079,9 +2099,10 @@ bool Compiler::StructPromotionHelper::TryPromoteStructField(lvaStructFieldInfo&
         return false;
     }
 
-    // Retype the field as the type of the single field of the struct.
+    // Retype the field as the type of the (possibly nested) single field of the struct.
     // This is a hack that allows us to promote such fields before we support recursive struct promotion
-    // (tracked by #10019).
+    // (tracked by #10019). fgMorphStructField knows how to fold the intermediate struct-typed field
+    // accesses onto the resulting scalar local.
     fieldInfo.fldType = fieldVarType;
     fieldInfo.fldSize = fieldSize;
 #ifdef DEBUG
@@ -185,9 +185,10 @@ void Lowering::LowerBlockStore(GenTreeBlk* blkNode)
 
                 if (fill == 0)
                 {
-                    // If the size is multiple of XMM register size there's no need to load 0 in a GPR,
-                    // codegen will use xorps to generate 0 directly in the temporary XMM register.
-                    if ((size % XMM_REGSIZE_BYTES) == 0)
+                    // If the size is at least the XMM register size there's no need to load 0 in a GPR,
+                    // codegen will use xorps to generate 0 directly in the temporary XMM register and
+                    // will handle any remainder with an overlapping XMM store.
+                    if (size >= XMM_REGSIZE_BYTES)
                     {
                         src->SetContained();
                     }
@@ -161,6 +161,44 @@ void lsraAssignRegToTree(GenTree* tree, regNumber reg, unsigned regIdx)
     }
 }
 
+//-------------------------------------------------------------
+// isRematerializableConstant: Check whether the tree temp defined or used by
+//    the given RefPosition is a constant that codegen will rematerialize at its
+//    use if it is spilled (see CodeGen::genIsRematerializableSpill).
+//
+// Arguments:
+//    refPos   -   ref position
+//
+// Returns:
+//    True if spilling the tree temp will not require a spill temp.
+//
+// Notes:
+//    Codegen only reloads from the spill temp when the use was left without a
+//    register and marked GTF_NOREG_AT_USE. That is decided after allocation, but
+//    it can only happen when the use is reg optional, so such constants are not
+//    considered rematerializable here.
+//
+bool LinearScan::isRematerializableConstant(RefPosition* refPos)
+{
+    GenTree* treeNode = refPos->treeNode;
+
+    if (!refPos->isIntervalRef() || (treeNode == nullptr) || !treeNode->IsCnsIntOrI() ||
+        !treeNode->AsIntConCommon()->ImmedValCanBeRematerialized(compiler))
+    {
+        return false;
+    }
+
+    for (RefPosition* ref = refPos->getInterval()->firstRefPosition; ref != nullptr; ref = ref->nextRefPosition)
+    {
+        if ((ref->refType == RefTypeUse) && ref->RegOptional())
+        {
+            return false;
+        }
+    }
+
+    return true;
+}
+
 //-------------------------------------------------------------
 // getWeight: Returns the weight of the RefPosition.
 //
@@ -189,6 +227,12 @@ unsigned LinearScan::getWeight(RefPosition* refPos)
                 weight -= BB_UNITY_WEIGHT;
             }
         }
+        else if (isRematerializableConstant(refPos))
+        {
+            // Constants are rematerialized at their use by codegen instead of being stored to
+            // and reloaded from a spill temp, so they are cheaper to spill than other tree temps.
+            weight = blockInfo[refPos->bbNum].weight;
+        }
         else
         {
             // Non-candidate local ref or non-lcl tree node.
@@ -1126,6 +1126,7 @@ private:
 
     void associateRefPosWithInterval(RefPosition* rp);
 
+    bool isRematerializableConstant(RefPosition* refPos);
     unsigned getWeight(RefPosition* refPos);
 
     /*****************************************************************************
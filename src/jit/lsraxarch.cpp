@@ -1301,7 +1301,7 @@ int LinearScan::BuildBlockStore(GenTreeBlk* blkNode)
                 }
 
 #ifdef _TARGET_X86_
-                if ((size & 1) != 0)
+                if ((size < XMM_REGSIZE_BYTES) && ((size & 1) != 0))
                 {
                     // We'll need to store a byte so a byte register is needed on x86.
                     srcRegMask = allByteRegs();
@@ -1353,7 +1353,10 @@ int LinearScan::BuildBlockStore(GenTreeBlk* blkNode)
             switch (blkNode->gtBlkOpKind)
             {
                 case GenTreeBlk::BlkOpKindUnroll:
-                    if ((size % XMM_REGSIZE_BYTES) != 0)
+                    // Blocks of at least XMM_REGSIZE_BYTES copy any remainder using an
+                    // overlapping XMM load/store so they only need an integer temp if
+                    // they're smaller than that.
+                    if (size < XMM_REGSIZE_BYTES)
                     {
                         regMaskTP regMask = allRegs(TYP_INT);
 #ifdef _TARGET_X86_
@@ -5539,7 +5539,12 @@ GenTree* Compiler::fgMorphArrayIndex(GenTree* tree)
         }
         else
         {
-            index = gtNewCastNode(TYP_I_IMPL, index, false, TYP_I_IMPL);
+            // If we range checked the index above then it is known to be in [0..arrLen), so
+            // we can zero extend it rather than sign extend it. Loop induction variables used
+            // as array indices are typically produced by 32 bit arithmetic that already zeroes
+            // the upper 32 bits of the register, which allows codegen to omit the extension.
+            const bool isNonNegative = chkd;
+            index = gtNewCastNode(TYP_I_IMPL, index, isNonNegative, TYP_I_IMPL);
         }
     }
 #endif // _TARGET_64BIT_
@@ -17020,6 +17025,45 @@ void Compiler::fgMorphStructField(GenTree* tree, GenTree* parent)
                 }
 #endif // DEBUG
             }
+            else if ((tree->TypeGet() == TYP_STRUCT) && varDsc->lvIsStructField && (field->gtFldOffset == 0))
+            {
+                // A nested single-field wrapper struct that struct promotion retyped as its innermost
+                // scalar (see StructPromotionHelper::TryPromoteStructField). The enclosing field access
+                // has already been replaced with the scalar field local, so this intermediate struct
+                // typed access denotes the very same bits. Make sure the struct really is a wrapper
+                // that fills the local before reusing it.
+                CORINFO_CLASS_HANDLE fieldClass = info.compCompHnd->getFieldClass(field->gtFldHnd);
+
+                if ((info.compCompHnd->getClassNumInstanceFields(fieldClass) == 1) &&
+                    (info.compCompHnd->getClassSize(fieldClass) == genTypeSize(varDsc->TypeGet())) &&
+                    (info.compCompHnd->getFieldOffset(info.compCompHnd->getFieldInClass(fieldClass, 0)) == 0))
+                {
+                    INDEBUG(structPromotionHelper->CheckRetypedAsScalar(field->gtFldHnd, varDsc->TypeGet()));
+
+                    tree->ChangeOper(GT_LCL_VAR);
+                    tree->AsLclVarCommon()->SetLclNum(lclNum);
+                    tree->gtType = varDsc->TypeGet();
+                    tree->gtFlags &= GTF_NODE_MASK;
+
+                    if (parent->gtOper == GT_ASG)
+                    {
+                        if (parent->AsOp()->gtOp1 == tree)
+                        {
+                            tree->gtFlags |= GTF_VAR_DEF;
+                        }
+
+                        // As for the promoted case above, keep a scalar on either side of a block
+                        // assignment away from CSE and constant propagation.
+                        tree->gtFlags |= GTF_DONT_CSE;
+                    }
+#ifdef DEBUG
+                    if (verbose)
+                    {
+                        printf("Replacing the nested wrapper field with retyped local var V%02u\n", lclNum);
+                    }
+#endif // DEBUG
+                }
+            }
         }
     }
 }
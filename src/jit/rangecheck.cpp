@@ -870,7 +870,13 @@ Range RangeCheck::ComputeRangeForLocalDef(BasicBlock*          block,
 // I believe practical limits are still smaller than this number.
 #define ARRLEN_MAX (0x7FFFFFFF)
 
-// Get the limit's maximum possible value, treating array length to be ARRLEN_MAX.
+// The runtime refuses to allocate arrays longer than this in any dimension (see
+// MaxArrayLength in gchelpers.cpp), so an actual array length never exceeds it.
+// Other checked bounds, such as span lengths, may still be as large as ARRLEN_MAX.
+#define ARRLEN_MAX_ALLOCATABLE (0x7FFFFFC7)
+
+// Get the limit's maximum possible value, treating array length to be ARRLEN_MAX_ALLOCATABLE
+// and any other bound to be ARRLEN_MAX.
 bool RangeCheck::GetLimitMax(Limit& limit, int* pMax)
 {
     int& max1 = *pMax;
@@ -885,7 +891,9 @@ bool RangeCheck::GetLimitMax(Limit& limit, int* pMax)
             int tmp = GetArrLength(limit.vn);
             if (tmp <= 0)
             {
-                tmp = ARRLEN_MAX;
+                // Knowing the bound is an array length lets strided loops such as
+                // "for (i = 0; i < a.Length; i += 4)" prove that "i + 4" cannot overflow.
+                tmp = m_pCompiler->vnStore->IsVNArrLen(limit.vn) ? ARRLEN_MAX_ALLOCATABLE : ARRLEN_MAX;
             }
             if (IntAddOverflows(tmp, limit.GetConstant()))
             {
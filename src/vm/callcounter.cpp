@@ -27,27 +27,64 @@ CallCounterEntry CallCounterEntry::CreateWithCallCountingDisabled(MethodDesc *m)
     return entry;
 }
 
-CallCounter::CallCounter()
+CallCounter::CallCounter() : m_partitions(NULL)
 {
     LIMITED_METHOD_CONTRACT;
 
-    m_lock.Init(LOCK_TYPE_DEFAULT);
+    m_partition.m_lock.Init(LOCK_TYPE_DEFAULT);
+}
+
+CallCounter::~CallCounter()
+{
+    LIMITED_METHOD_CONTRACT;
+
+    delete[] m_partitions;
+}
+
+// Called once for the global loader allocator, before any method is call counted
+void CallCounter::EnablePartitioning()
+{
+    STANDARD_VM_CONTRACT;
+    _ASSERTE(m_partitions == NULL);
+    _ASSERTE(m_partition.m_methodToCallCount.GetCount() == 0);
+
+    PaddedPartition *partitions = new PaddedPartition[PartitionCount];
+    for (COUNT_T i = 0; i < PartitionCount; ++i)
+    {
+        partitions[i].m_lock.Init(LOCK_TYPE_DEFAULT);
+    }
+    m_partitions = partitions;
 }
 
 #endif // !DACCESS_COMPILE
 
+CallCounter::Partition *CallCounter::GetPartition(PTR_MethodDesc pMethodDesc)
+{
+    LIMITED_METHOD_DAC_CONTRACT;
+    static_assert_no_msg((PartitionCount & (PartitionCount - 1)) == 0);
+
+    if (m_partitions == NULL)
+    {
+        return &m_partition;
+    }
+
+    // MethodDescs are at least pointer-aligned, so skip the low bits that are always zero
+    return m_partitions + ((dac_cast<TADDR>(pMethodDesc) / sizeof(void *)) & (PartitionCount - 1));
+}
+
 bool CallCounter::IsCallCountingEnabled(PTR_MethodDesc pMethodDesc)
 {
     WRAPPER_NO_CONTRACT;
     _ASSERTE(pMethodDesc != PTR_NULL);
     _ASSERTE(pMethodDesc->IsEligibleForTieredCompilation());
 
+    Partition *partition = GetPartition(pMethodDesc);
 #ifndef DACCESS_COMPILE
-    SpinLockHolder holder(&m_lock);
+    SpinLockHolder holder(&partition->m_lock);
 #endif
 
     PTR_CallCounterEntry entry =
-        (PTR_CallCounterEntry)const_cast<CallCounterEntry *>(m_methodToCallCount.LookupPtr(pMethodDesc));
+        (PTR_CallCounterEntry)const_cast<CallCounterEntry *>(partition->m_methodToCallCount.LookupPtr(pMethodDesc));
     return entry == PTR_NULL || entry->IsCallCountingEnabled();
 }
 
@@ -66,9 +103,11 @@ void CallCounter::DisableCallCounting(MethodDesc* pMethodDesc)
     // called yet (if the entry does not yet exist in the hash table), if necessary that could be a different function like
     // TryDisable...() that would fail to disable call counting if the method has already been called.
 
-    SpinLockHolder holder(&m_lock);
+    Partition *partition = GetPartition(pMethodDesc);
+    SpinLockHolder holder(&partition->m_lock);
 
-    CallCounterEntry *existingEntry = const_cast<CallCounterEntry *>(m_methodToCallCount.LookupPtr(pMethodDesc));
+    CallCounterEntry *existingEntry =
+        const_cast<CallCounterEntry *>(partition->m_methodToCallCount.LookupPtr(pMethodDesc));
     if (existingEntry != nullptr)
     {
         existingEntry->DisableCallCounting();
@@ -77,7 +116,7 @@ void CallCounter::DisableCallCounting(MethodDesc* pMethodDesc)
 
     // Typically, the entry would already exist because OnMethodCalled() would have been called before this function on the same
     // thread. With multi-core JIT, a function may be jitted before it is called, in which case the entry would not exist.
-    m_methodToCallCount.Add(CallCounterEntry::CreateWithCallCountingDisabled(pMethodDesc));
+    partition->m_methodToCallCount.Add(CallCounterEntry::CreateWithCallCountingDisabled(pMethodDesc));
 }
 
 NOINLINE bool CallCounter::OnMethodCodeVersionCalledSubsequently(NativeCodeVersion nativeCodeVersion, bool *doPublishRef)
@@ -127,15 +166,17 @@ bool CallCounter::IncrementCount(MethodDesc* pMethodDesc)
     // PERF: This as a simple to implement, but not so performant, call counter
     // Currently this is only called until we reach a fixed call count and then
     // disabled. Its likely we'll want to improve this at some point but
-    // its not as bad as you might expect. Allocating a counter inline in the
-    // MethodDesc or at some location computable from the MethodDesc should
-    // eliminate 1 pointer per-method (the MethodDesc* key) and the CPU
-    // overhead to acquire the lock/search the dictionary. Depending on where it
-    // is we may also be able to reduce it to 1 byte counter without wasting the
-    // following bytes for alignment. Further work to inline the OnMethodCalled
-    // callback directly into the jitted code would eliminate CPU overhead of
-    // leaving the prestub unpatched, but may not be good overall as it increases
-    // the size of the jitted code.
+    // its not as bad as you might expect. The table is partitioned by method
+    // to limit lock contention between threads calling different methods.
+    // Allocating a counter inline in the MethodDesc or at some location
+    // computable from the MethodDesc should eliminate 1 pointer per-method
+    // (the MethodDesc* key) and the CPU overhead to acquire the lock/search
+    // the dictionary. Depending on where it is we may also be able to reduce
+    // it to 1 byte counter without wasting the following bytes for alignment.
+    // Further work to inline the OnMethodCalled callback directly into the
+    // jitted code would eliminate CPU overhead of leaving the prestub
+    // unpatched, but may not be good overall as it increases the size of the
+    // jitted code.
 
     int callCountLimit;
     {
@@ -145,13 +186,14 @@ bool CallCounter::IncrementCount(MethodDesc* pMethodDesc)
         //but TieredCompilationManager::OnMethodCalled() doesn't expect multiple calls
         //each claiming to be exactly the threshhold call count needed to trigger
         //optimization.
-        SpinLockHolder holder(&m_lock);
-        CallCounterEntry* pEntry = const_cast<CallCounterEntry*>(m_methodToCallCount.LookupPtr(pMethodDesc));
+        Partition *partition = GetPartition(pMethodDesc);
+        SpinLockHolder holder(&partition->m_lock);
+        CallCounterEntry* pEntry = const_cast<CallCounterEntry*>(partition->m_methodToCallCount.LookupPtr(pMethodDesc));
         if (pEntry == NULL)
         {
             callCountLimit = (int)g_pConfig->TieredCompilation_CallCountThreshold() - 1;
             _ASSERTE(callCountLimit >= 0);
-            m_methodToCallCount.Add(CallCounterEntry(pMethodDesc, callCountLimit));
+            partition->m_methodToCallCount.Add(CallCounterEntry(pMethodDesc, callCountLimit));
         }
         else if (pEntry->IsCallCountingEnabled())
         {
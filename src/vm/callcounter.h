@@ -88,6 +88,9 @@ public:
     CallCounter() {}
 #else
     CallCounter();
+    ~CallCounter();
+
+    void EnablePartitioning();
 #endif
 
     bool IsCallCountingEnabled(PTR_MethodDesc pMethodDesc);
@@ -99,10 +102,34 @@ public:
     bool IncrementCount(MethodDesc* pMethodDesc);
 
 private:
+    // The call counts of the global loader allocator, which holds all methods that are not collectible, are partitioned by
+    // method so that threads calling different methods during startup rarely contend on the same lock. Other loader
+    // allocators (collectible assemblies and load contexts) use a single partition, as there can be many of them and each
+    // set of partitions costs over 2 KB. The partition count must be a power of two.
+    static const COUNT_T PartitionCount = 16;
+
+    struct Partition
+    {
+        // fields protected by lock
+        SpinLock m_lock;
+        CallCounterHash m_methodToCallCount;
+    };
+
+    struct PaddedPartition : public Partition
+    {
+        // Padding so that neighboring partitions, which are locked by threads calling different methods, never share a
+        // cache line. The partitions are allocated on the heap whose alignment is not guaranteed, so a full cache line of
+        // padding is used rather than aligning each partition.
+        BYTE m_padding[MAX_CACHE_LINE_SIZE];
+    };
+    typedef DPTR(PaddedPartition) PTR_PaddedPartition;
+
+    Partition *GetPartition(PTR_MethodDesc pMethodDesc);
+
+    Partition m_partition;
 
-    // fields protected by lock
-    SpinLock m_lock;
-    CallCounterHash m_methodToCallCount;
+    // PartitionCount partitions used instead of m_partition after EnablePartitioning(), otherwise NULL
+    PTR_PaddedPartition m_partitions;
 };
 
 #endif // FEATURE_TIERED_COMPILATION
@@ -1322,6 +1322,21 @@ TypeHandle ClassLoader::LookupTypeKey(TypeKey *pKey,
 
     if (fCheckUnderLock)
     {
+        // A lock-free lookup can only miss a type that is present if it raced with the table being resized.
+        // Repeat the lookup without the lock, bracketed by the table's resize count, and only fall back to
+        // taking the lock if a resize was in progress or completed in the meantime. This keeps the common
+        // case of looking up a type that simply has not been loaded yet off m_AvailableTypesLock.
+        DWORD cResizes = pTable->GetResizeCount();
+        if ((cResizes & 1) == 0)
+        {
+            th = pTable->GetValue(pKey);
+
+            // Don't let the reads of the bucket chains move past the re-read of the resize count.
+            MemoryBarrier();
+            if (!th.IsNull() || pTable->GetResizeCount() == cResizes)
+                return th;
+        }
+
         th = LookupTypeKeyUnderLock(pKey, pTable, pLock);
     }
     else
@@ -1397,11 +1412,12 @@ TypeHandle ClassLoader::LookupTypeHandleForTypeKey(TypeKey *pKey)
 
     // A non-null TypeHandle for the above lookup indicates success
     // A null TypeHandle only indicates "well, it might have been there,
-    // try again with a lock".  This kind of negative result will
-    // only happen while accessing the underlying EETypeHashTable
-    // during a resize, i.e. very rarely. In such a case, we just
-    // perform the lookup again, but indicate that appropriate locks
-    // should be taken.
+    // try again with a lock".  This kind of negative result is only
+    // wrong while accessing the underlying EETypeHashTable during a
+    // resize, i.e. very rarely. In such a case, we just perform the
+    // lookup again, but indicate that appropriate locks should be
+    // taken if needed (LookupTypeKey only takes them if it can see
+    // that a resize actually overlapped its lookup).
 
     if (th.IsNull())
     {
@@ -3054,6 +3054,7 @@ PTR_EXCEPTION_CLAUSE_TOKEN EEJitManager::GetNextEHClause(EH_CLAUSE_ENUMERATOR* p
 
 #ifndef DACCESS_COMPILE
 TypeHandle EEJitManager::ResolveEHClause(EE_ILEXCEPTION_CLAUSE* pEHClause,
+                                         PTR_EXCEPTION_CLAUSE_TOKEN pEHClauseToken,
                                          CrawlFrame *pCf)
 {
     // We don't want to use a runtime contract here since this codepath is used during
@@ -3064,21 +3065,25 @@ TypeHandle EEJitManager::ResolveEHClause(EE_ILEXCEPTION_CLAUSE* pEHClause,
 
     _ASSERTE(NULL != pCf);
     _ASSERTE(NULL != pEHClause);
+    _ASSERTE(NULL != pEHClauseToken);
     _ASSERTE(IsTypedHandler(pEHClause));
 
+    // pEHClause is the caller's copy of the clause; the resolved type handle has to be
+    // cached in the clause stored with the method's EH info so later dispatches see it.
+    EE_ILEXCEPTION_CLAUSE* pCachedEHClause = (EE_ILEXCEPTION_CLAUSE*)pEHClauseToken;
 
     TypeHandle typeHnd = TypeHandle();
     mdToken typeTok = mdTokenNil;
 
     {
         CrstHolder chRead(&m_EHClauseCritSec);
-        if (HasCachedTypeHandle(pEHClause))
+        if (HasCachedTypeHandle(pCachedEHClause))
         {
-            typeHnd = TypeHandle::FromPtr(pEHClause->TypeHandle);
+            typeHnd = TypeHandle::FromPtr(pCachedEHClause->TypeHandle);
         }
         else
         {
-            typeTok = pEHClause->ClassToken;
+            typeTok = pCachedEHClause->ClassToken;
         }
     }
 
@@ -3142,20 +3147,20 @@ TypeHandle EEJitManager::ResolveEHClause(EE_ILEXCEPTION_CLAUSE* pEHClause,
         CrstHolder chWrite(&m_EHClauseCritSec);
 
         // Note another thread might have beaten us to it ...
-        if (!HasCachedTypeHandle(pEHClause))
+        if (!HasCachedTypeHandle(pCachedEHClause))
         {
             // We should never cache a NULL typeHnd.
             _ASSERTE(!typeHnd.IsNull());
-            pEHClause->TypeHandle = typeHnd.AsPtr();
-            SetHasCachedTypeHandle(pEHClause);
+            pCachedEHClause->TypeHandle = typeHnd.AsPtr();
+            SetHasCachedTypeHandle(pCachedEHClause);
         }
         else
         {
             // If we raced in here with another thread and got held up on the lock, then we just need to return the
             // type handle that the other thread put into the clause.
             // The typeHnd we found and the typeHnd the racing thread found should always be the same
-            _ASSERTE(typeHnd.AsPtr() == pEHClause->TypeHandle);
-            typeHnd = TypeHandle::FromPtr(pEHClause->TypeHandle);
+            _ASSERTE(typeHnd.AsPtr() == pCachedEHClause->TypeHandle);
+            typeHnd = TypeHandle::FromPtr(pCachedEHClause->TypeHandle);
         }
     }
     return typeHnd;
@@ -5467,6 +5472,7 @@ PTR_EXCEPTION_CLAUSE_TOKEN NativeImageJitManager::GetNextEHClause(EH_CLAUSE_ENUM
 #ifndef DACCESS_COMPILE
 
 TypeHandle NativeImageJitManager::ResolveEHClause(EE_ILEXCEPTION_CLAUSE* pEHClause,
+                                              PTR_EXCEPTION_CLAUSE_TOKEN pEHClauseToken,
                                               CrawlFrame* pCf)
 {
     CONTRACTL {
@@ -6682,6 +6688,7 @@ StubCodeBlockKind ReadyToRunJitManager::GetStubCodeBlockKind(RangeSection * pRan
 #ifndef DACCESS_COMPILE
 
 TypeHandle ReadyToRunJitManager::ResolveEHClause(EE_ILEXCEPTION_CLAUSE* pEHClause,
+                                              PTR_EXCEPTION_CLAUSE_TOKEN pEHClauseToken,
                                               CrawlFrame* pCf)
 {
     CONTRACTL {
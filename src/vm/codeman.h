@@ -764,6 +764,7 @@ public:
                                  EE_ILEXCEPTION_CLAUSE* pEHclause)=0;
 #ifndef DACCESS_COMPILE
     virtual TypeHandle  ResolveEHClause(EE_ILEXCEPTION_CLAUSE* pEHClause,
+                                        PTR_EXCEPTION_CLAUSE_TOKEN pEHClauseToken,
                                         CrawlFrame *pCf)=0;
 #endif // #ifndef DACCESS_COMPILE
 
@@ -999,6 +1000,7 @@ public:
                                         EE_ILEXCEPTION_CLAUSE* pEHclause);
 #ifndef DACCESS_COMPILE
     virtual TypeHandle  ResolveEHClause(EE_ILEXCEPTION_CLAUSE* pEHClause,
+                                        PTR_EXCEPTION_CLAUSE_TOKEN pEHClauseToken,
                                         CrawlFrame *pCf);
 #endif // !DACCESS_COMPILE
     GCInfoToken         GetGCInfoToken(const METHODTOKEN& MethodToken);
@@ -1595,6 +1597,7 @@ public:
 
 #ifndef DACCESS_COMPILE
     virtual TypeHandle  ResolveEHClause(EE_ILEXCEPTION_CLAUSE* pEHClause,
+                                        PTR_EXCEPTION_CLAUSE_TOKEN pEHClauseToken,
                                         CrawlFrame *pCf);
 #endif // #ifndef DACCESS_COMPILE
 
@@ -1713,6 +1716,7 @@ public:
 
 #ifndef DACCESS_COMPILE
     virtual TypeHandle  ResolveEHClause(EE_ILEXCEPTION_CLAUSE* pEHClause,
+                                        PTR_EXCEPTION_CLAUSE_TOKEN pEHClauseToken,
                                         CrawlFrame *pCf);
 #endif // #ifndef DACCESS_COMPILE
 
@@ -337,6 +337,7 @@ HRESULT EEConfig::Init()
     fTieredCompilation_CallCounting = false;
     tieredCompilation_CallCountThreshold = 1;
     tieredCompilation_CallCountingDelayMs = 0;
+    tieredCompilation_BackgroundWorkerCount = 1;
 #endif
 
 #ifndef CROSSGEN_COMPILE
@@ -1233,6 +1234,23 @@ fTrackDynamicMethodDebugInfo = CLRConfig::GetConfigValue(CLRConfig::UNSUPPORTED_
             }
         }
 
+        // Background jitting at higher tiers competes with the application for processors, so never use more workers than
+        // there are processors available to the process, and by default use a quarter of them
+        DWORD processorCount = (DWORD)GetCurrentProcessCpuCount();
+        tieredCompilation_BackgroundWorkerCount = CLRConfig::GetConfigValue(CLRConfig::INTERNAL_TC_BackgroundWorkerCount);
+        if (tieredCompilation_BackgroundWorkerCount == 0)
+        {
+            tieredCompilation_BackgroundWorkerCount = processorCount / 4;
+        }
+        if (tieredCompilation_BackgroundWorkerCount > processorCount)
+        {
+            tieredCompilation_BackgroundWorkerCount = processorCount;
+        }
+        if (tieredCompilation_BackgroundWorkerCount < 1)
+        {
+            tieredCompilation_BackgroundWorkerCount = 1;
+        }
+
         if (ETW::CompilationLog::TieredCompilation::Runtime::IsEnabled())
         {
             ETW::CompilationLog::TieredCompilation::Runtime::SendSettings();
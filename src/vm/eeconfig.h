@@ -286,6 +286,7 @@ public:
     bool          TieredCompilation_CallCounting()  const { LIMITED_METHOD_CONTRACT; return fTieredCompilation_CallCounting; }
     DWORD         TieredCompilation_CallCountThreshold() const { LIMITED_METHOD_CONTRACT; return tieredCompilation_CallCountThreshold; }
     DWORD         TieredCompilation_CallCountingDelayMs() const { LIMITED_METHOD_CONTRACT; return tieredCompilation_CallCountingDelayMs; }
+    DWORD         TieredCompilation_BackgroundWorkerCount() const { LIMITED_METHOD_CONTRACT; return tieredCompilation_BackgroundWorkerCount; }
 #endif
 
 #ifndef CROSSGEN_COMPILE
@@ -1021,6 +1022,7 @@ private: //----------------------------------------------------------------
     bool fTieredCompilation_CallCounting;
     DWORD tieredCompilation_CallCountThreshold;
     DWORD tieredCompilation_CallCountingDelayMs;
+    DWORD tieredCompilation_BackgroundWorkerCount;
 #endif
 
 #ifndef CROSSGEN_COMPILE
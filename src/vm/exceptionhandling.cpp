@@ -3068,7 +3068,8 @@ CLRUnwindStatus ExceptionTracker::ProcessManagedCallFrame(
 
                         if (!thrownType.IsNull())
                         {
-                            if (EHClause.ClassToken == mdTypeRefNil)
+                            // A clause whose type has already been resolved holds the type handle instead of the token
+                            if (!HasCachedTypeHandle(&EHClause) && (EHClause.ClassToken == mdTypeRefNil))
                             {
                                 // this is a catch(...)
                                 fFoundHandler = TRUE;
@@ -3078,7 +3079,7 @@ CLRUnwindStatus ExceptionTracker::ProcessManagedCallFrame(
                                 TypeHandle typeHnd;
                                 EX_TRY
                                 {
-                                    typeHnd = pJitMan->ResolveEHClause(&EHClause, pcfThisFrame);
+                                    typeHnd = pJitMan->ResolveEHClause(&EHClause, pEHClauseToken, pcfThisFrame);
                                 }
                                 EX_CATCH_EX(Exception)
                                 {
@@ -378,8 +378,12 @@ InstantiatedMethodDesc::NewInstantiatedMethodDesc(MethodTable *pExactMT,
             }
             else if (getWrappedCode)
             {
-                // 4 seems like a good number
-                pDL = DictionaryLayout::Allocate(4, pAllocator, &amt);
+                // 4 seems like a good number for a single type argument. As for class dictionaries (see
+                // MethodTableBuilder::AllocAndInitDictionary), methods with more generic parameters tend to use
+                // more slots, so multiply by 1.5 for 2 params or more. Lookups that don't fit are served from the
+                // much slower JIT_GenericHandle overflow cache on every call.
+                WORD numSlots = (methodInst.GetNumArgs() == 1) ? 4 : 6;
+                pDL = DictionaryLayout::Allocate(numSlots, pAllocator, &amt);
 #ifdef _DEBUG
                 {
                     SString name;
@@ -2511,7 +2511,7 @@ StackWalkAction COMPlusThrowCallback(       // SWA value
 
     for(ULONG i=0; i < EHCount; i++)
     {
-        pJitManager->GetNextEHClause(&pEnumState, &EHClause);
+        PTR_EXCEPTION_CLAUSE_TOKEN pEHClauseToken = pJitManager->GetNextEHClause(&pEnumState, &EHClause);
         _ASSERTE(IsValidClause(&EHClause));
 
         STRESS_LOG4(LF_EH, LL_INFO100, "COMPlusThrowCallback: considering '%s' clause [%d,%d], ofs:%d\n",
@@ -2560,14 +2560,15 @@ StackWalkAction COMPlusThrowCallback(       // SWA value
 
         if (isTypedHandler && !thrownType.IsNull())
         {
-            if (EHClause.TypeHandle == (void*)(size_t)mdTypeRefNil)
+            // A clause whose type has already been resolved holds the type handle instead of the token
+            if (!HasCachedTypeHandle(&EHClause) && (EHClause.ClassToken == mdTypeRefNil))
             {
                 // this is a catch(...)
                 typeMatch = TRUE;
             }
             else
             {
-                TypeHandle exnType = pJitManager->ResolveEHClause(&EHClause,pCf);
+                TypeHandle exnType = pJitManager->ResolveEHClause(&EHClause, pEHClauseToken, pCf);
 
                 // if doesn't have cached class then class wasn't loaded so couldn't have been thrown
                 typeMatch = !exnType.IsNull() && ExceptionIsOfRightType(exnType, thrownType);
@@ -3779,10 +3779,14 @@ CORINFO_GENERIC_HANDLE JIT_GenericHandleWorker(MethodDesc * pMD, MethodTable * p
         if (pMT != NULL)
         {
             pDictDomain = pDeclaringMT->GetDomain();
+            LOG((LF_JIT, LL_INFO1000, "GENERICS: Dictionary overflow for %s, lookup will use the generic handle cache\n",
+                 pDeclaringMT->GetDebugClassName()));
         }
         else
         {
             pDictDomain = pMD->GetDomain();
+            LOG((LF_JIT, LL_INFO1000, "GENERICS: Dictionary overflow for %s::%s, lookup will use the generic handle cache\n",
+                 pMD->m_pszDebugClassName, pMD->m_pszDebugMethodName));
         }
 
         // Add the normalized key (pDeclaringMT) here so that future lookups of any
@@ -20,6 +20,10 @@ inline LOADERALLOCATORREF LoaderAllocator::GetExposedObject()
 inline void GlobalLoaderAllocator::Init(BaseDomain *pDomain)
 {
     LoaderAllocator::Init(pDomain, m_ExecutableHeapInstance);
+
+#ifdef FEATURE_TIERED_COMPILATION
+    GetCallCounter()->EnablePartitioning();
+#endif
 }
 
 inline void AssemblyLoaderAllocator::Init(AppDomain* pAppDomain)
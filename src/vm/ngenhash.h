@@ -243,6 +243,11 @@ protected:
     // yet).
     DWORD BaseGetElementCount();
 
+    // Return a count that is bumped once before and once after every resize of the warm bucket list (so it's
+    // odd while a resize is in progress). A lock-free lookup that missed can trust the miss if this value was
+    // even before the lookup and is unchanged after it; otherwise the lookup must be retried under the lock.
+    DWORD BaseGetResizeCount();
+
     // Initializes the iterator context passed by the caller to make it ready to walk every entry in the table
     // in an arbitrary order. Call pIterator->Next() to retrieve the first entry.
     void BaseInitIterator(BaseIterator *pIterator);
@@ -536,6 +541,8 @@ private:
     RelativePointer<DPTR(PTR_VolatileEntry)> m_pWarmBuckets;  // Pointer to a simple bucket list (array of VolatileEntry pointers)
     DWORD                                    m_cWarmBuckets;  // Count of buckets in the above array (always non-zero)
     DWORD                                    m_cWarmEntries;  // Count of elements in the warm section of the hash
+    DWORD                                    m_cWarmResizes;  // Bumped before and after each GrowTable (see
+                                                              // BaseGetResizeCount)
 
 #ifdef FEATURE_PREJIT
     PersistedEntries        m_sHotEntries;      // Hot persisted hash entries (if any)
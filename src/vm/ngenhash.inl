@@ -54,6 +54,7 @@ NgenHashTable<NGEN_HASH_ARGS>::NgenHashTable(Module *pModule, LoaderHeap *pHeap,
     S_SIZE_T cbBuckets = S_SIZE_T(sizeof(VolatileEntry*)) * S_SIZE_T(cInitialBuckets);
 
     m_cWarmEntries = 0;
+    m_cWarmResizes = 0;
     m_cWarmBuckets = cInitialBuckets;
     m_pWarmBuckets.SetValue((PTR_VolatileEntry*)(void*)GetHeap()->AllocMem(cbBuckets));
 
@@ -195,6 +196,12 @@ void NgenHashTable<NGEN_HASH_ARGS>::GrowTable()
     // Note: Memory allocated on loader heap is zero filled
     // memset(pNewBuckets, 0, cNewBuckets * sizeof(PTR_VolatileEntry));
 
+    // Let lock-free readers know that bucket chains are about to be rearranged under them, so that a miss
+    // they see from here until the resize count is bumped again cannot be trusted (see BaseGetResizeCount).
+    // Writers are serialized by the caller's lock so a plain increment is sufficient.
+    m_cWarmResizes++;
+    MemoryBarrier();
+
     // Run through the old table and transfer all the entries. Be sure not to mess with the integrity of the
     // old table while we are doing this, as there can be concurrent readers! Note that it is OK if the
     // concurrent reader misses out on a match, though - they will have to acquire the lock on a miss & try
@@ -233,6 +240,10 @@ void NgenHashTable<NGEN_HASH_ARGS>::GrowTable()
     // itself a reader could potentially read buckets from beyond the end of the old bucket list).
     MemoryBarrier();
     m_cWarmBuckets = cNewBuckets;
+
+    // Resize complete: readers that started after this point can trust a miss again.
+    MemoryBarrier();
+    m_cWarmResizes++;
 }
 
 // Returns the next prime larger (or equal to) than the number given.
@@ -263,6 +274,16 @@ DWORD NgenHashTable<NGEN_HASH_ARGS>::BaseGetElementCount()
         ;
 }
 
+// Return a count that is bumped once before and once after every resize of the warm bucket list (so it's odd
+// while a resize is in progress). See GrowTable for the writer side of this protocol.
+template <NGEN_HASH_PARAMS>
+DWORD NgenHashTable<NGEN_HASH_ARGS>::BaseGetResizeCount()
+{
+    LIMITED_METHOD_DAC_CONTRACT;
+
+    return VolatileLoad(&m_cWarmResizes);
+}
+
 // Find first entry matching a given hash value (returns NULL on no match). Call BaseFindNextEntryByHash to
 // iterate the remaining matches (until it returns NULL). The LookupContext supplied by the caller is
 // initialized by BaseFindFirstEntryByHash and read/updated by BaseFindNextEntryByHash to keep track of where
@@ -1001,6 +1022,7 @@ void NgenHashTable<NGEN_HASH_ARGS>::BaseSave(DataImage *pImage, CorProfileData *
     // Reset the ngen-version of the table to have no warm entries and the reduced warm bucket count.
     NgenHashTable<NGEN_HASH_ARGS> *pNewTable = (NgenHashTable<NGEN_HASH_ARGS>*)pImage->GetImagePointer(this);
     pNewTable->m_cWarmEntries = 0;
+    pNewTable->m_cWarmResizes = 0;
     pNewTable->m_cWarmBuckets = cNewWarmBuckets;
 
     // Zero-out the ngen version of the warm buckets.
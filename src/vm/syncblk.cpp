@@ -1300,9 +1300,15 @@ BOOL SyncBlockCache::GCWeakPtrScanElement (int nb, HANDLESCANPROC scanProc, LPAR
             if (*keyv)
             {
                 _ASSERTE (pSB);
+                DWORD hashCode = pSB->GetHashCode();
                 GCDeleteSyncBlock(pSB);
-                //clean the object syncblock header
-                ((Object*)(*keyv))->GetHeader()->GCResetIndex();
+                //clean the object syncblock header, keeping the hash code if
+                //that is all the syncblock was holding on to
+                ObjHeader *pHeader = ((Object*)(*keyv))->GetHeader();
+                if (hashCode != 0)
+                    pHeader->GCResetIndexToHashCode(hashCode);
+                else
+                    pHeader->GCResetIndex();
             }
             else if (pSB)
             {
@@ -1623,15 +1629,18 @@ AwareLock::EnterHelperResult ObjHeader::EnterObjMonitorHelperSpin(Thread* pCurTh
                 return result;
             }
 
+            // Spin no longer than spinning has recently paid off for this lock
+            const DWORD lockSpinCount = min(spinCount, awareLock->GetSpinCount());
+
             ++spinIteration;
-            if (spinIteration < spinCount)
+            if (spinIteration < lockSpinCount)
             {
                 while (true)
                 {
                     AwareLock::SpinWait(normalizationInfo, spinIteration);
 
                     ++spinIteration;
-                    if (spinIteration >= spinCount)
+                    if (spinIteration >= lockSpinCount)
                     {
                         // The last lock attempt for this spin will be done after the loop
                         break;
@@ -1640,6 +1649,7 @@ AwareLock::EnterHelperResult ObjHeader::EnterObjMonitorHelperSpin(Thread* pCurTh
                     result = awareLock->TryEnterInsideSpinLoopHelper(pCurThread);
                     if (result == AwareLock::EnterHelperResult_Entered)
                     {
+                        awareLock->RecordSpinSucceeded();
                         return AwareLock::EnterHelperResult_Entered;
                     }
                     if (result == AwareLock::EnterHelperResult_UseSlowPath)
@@ -1651,8 +1661,11 @@ AwareLock::EnterHelperResult ObjHeader::EnterObjMonitorHelperSpin(Thread* pCurTh
 
             if (awareLock->TryEnterAfterSpinLoopHelper(pCurThread))
             {
+                awareLock->RecordSpinSucceeded();
                 return AwareLock::EnterHelperResult_Entered;
             }
+
+            awareLock->RecordSpinFailed();
             break;
         }
 
@@ -2393,6 +2406,7 @@ void AwareLock::Enter()
         {
             // We get here if we successfully acquired the mutex.
             m_HoldingThread = pCurThread;
+            m_holdCount++;
             m_Recursion = 1;
             pCurThread->IncLockCount();
 
@@ -2456,6 +2470,7 @@ BOOL AwareLock::TryEnter(INT32 timeOut)
         {
             // We get here if we successfully acquired the mutex.
             m_HoldingThread = pCurThread;
+            m_holdCount++;
             m_Recursion = 1;
             pCurThread->IncLockCount();
 
@@ -2725,6 +2740,7 @@ BOOL AwareLock::EnterEpilogHelper(Thread* pCurThread, INT32 timeOut)
     }
 
     m_HoldingThread = pCurThread;
+    m_holdCount++;
     m_Recursion = 1;
     pCurThread->IncLockCount();
 
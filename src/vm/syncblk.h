@@ -445,8 +445,24 @@ private:
 
     DWORD m_waiterStarvationStartTimeMs;
 
+    // Number of spin iterations a contending thread performs on this lock before waiting. It starts at
+    // g_SpinConstants.dwMonitorSpinCount and adapts to how often spinning has recently acquired the lock, so that
+    // locks that are held for long periods stop burning CPU in spin loops that are not going to succeed.
+    DWORD m_spinCount;
+
+    // Number of times the lock has been acquired, and its value when a spinner last gave up on this lock. Spinners
+    // that give up during the same hold of the lock are all part of the same contention episode, and only the first of
+    // them adjusts m_spinCount. m_holdCount is only updated by the thread that just acquired the lock.
+    DWORD m_holdCount;
+    DWORD m_spinFailureHoldCount;
+
     static const DWORD WaiterStarvationDurationMsBeforeStoppingPreemptingWaiters = 100;
 
+    // Bounds and step for adapting m_spinCount. The spin count does not drop to zero so that a lock whose hold
+    // times become short again can recover.
+    static const DWORD MinimumSpinCount = 2;
+    static const DWORD SpinCountIncrement = 2;
+
     // Only SyncBlocks can create AwareLocks.  Hence this private constructor.
     AwareLock(DWORD indx)
         : m_Recursion(0),
@@ -456,7 +472,10 @@ private:
 #endif // DACCESS_COMPILE
           m_TransientPrecious(0),
           m_dwSyncIndex(indx),
-          m_waiterStarvationStartTimeMs(0)
+          m_waiterStarvationStartTimeMs(0),
+          m_spinCount(g_SpinConstants.dwMonitorSpinCount),
+          m_holdCount(0),
+          m_spinFailureHoldCount(0)
     {
         LIMITED_METHOD_CONTRACT;
     }
@@ -521,6 +540,11 @@ private:
     void RecordWaiterStarvationStartTime();
     bool ShouldStopPreemptingWaiters() const;
 
+public:
+    DWORD GetSpinCount() const;
+    void RecordSpinSucceeded();
+    void RecordSpinFailed();
+
 private: // friend access is required for this unsafe function
     void InitializeToLockedWithNoWaiters(ULONG recursionLevel, PTR_Thread holdingThread)
     {
@@ -529,6 +553,7 @@ private: // friend access is required for this unsafe function
         m_lockState.InitializeToLockedWithNoWaiters();
         m_Recursion = recursionLevel;
         m_HoldingThread = holdingThread;
+        m_holdCount++;
     }
 
 public:
@@ -833,9 +858,10 @@ class SyncBlock
     SLink       m_Link;
 
     // This is the hash code for the object. It can either have been transfered
-    // from the header dword, in which case it will be limited to 26 bits, or
-    // have been generated right into this member variable here, when it will
-    // be a full 32 bits.
+    // from the header dword or have been generated right into this member
+    // variable here. Either way it is limited to HASHCODE_BITS, so the GC can
+    // move it back into the header dword when it reclaims an otherwise idle
+    // syncblock (see SyncBlockCache::GCWeakPtrScanElement).
 
     // A 0 in this variable means no hash code has been set yet - this saves having
     // another flag to express this state, and it enables us to use a 32-bit interlocked
@@ -974,13 +1000,12 @@ class SyncBlock
     DWORD SetHashCode(DWORD hashCode)
     {
         WRAPPER_NO_CONTRACT;
+        // The hash code does not make the syncblock precious: if nothing else
+        // needs the syncblock, the GC hands the hash code back to the header.
+        _ASSERTE((hashCode & MASK_HASHCODE) == hashCode);
         DWORD result = FastInterlockCompareExchange((LONG*)&m_dwHashCode, hashCode, 0);
         if (result == 0)
-        {
-            // the sync block now holds a hash code, which we can't afford to lose.
-            SetPrecious();
             return hashCode;
-        }
         else
             return result;
     }
@@ -1357,6 +1382,16 @@ class ObjHeader
         m_SyncBlockValue.RawValue() &=~(BIT_SBLK_IS_HASH_OR_SYNCBLKINDEX | BIT_SBLK_IS_HASHCODE | MASK_SYNCBLOCKINDEX);
     }
 
+    // Used only GC, when a reclaimed syncblock held nothing but the hash code
+    void GCResetIndexToHashCode(DWORD hashCode)
+    {
+        LIMITED_METHOD_CONTRACT;
+
+        _ASSERTE(hashCode != 0 && (hashCode & MASK_HASHCODE) == hashCode);
+        m_SyncBlockValue.RawValue() = (m_SyncBlockValue.RawValue() & ~MASK_SYNCBLOCKINDEX) |
+                                      BIT_SBLK_IS_HASH_OR_SYNCBLKINDEX | BIT_SBLK_IS_HASHCODE | hashCode;
+    }
+
     // For now, use interlocked operations to twiddle bits in the bitfield portion.
     // If we ever have high-performance requirements where we can guarantee that no
     // other threads are accessing the ObjHeader, this can be reconsidered for those
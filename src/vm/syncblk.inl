@@ -458,6 +458,50 @@ FORCEINLINE bool AwareLock::ShouldStopPreemptingWaiters() const
         GetTickCount() - waiterStarvationStartTimeMs >= WaiterStarvationDurationMsBeforeStoppingPreemptingWaiters;
 }
 
+FORCEINLINE DWORD AwareLock::GetSpinCount() const
+{
+    LIMITED_METHOD_CONTRACT;
+    return VolatileLoadWithoutBarrier(&m_spinCount);
+}
+
+FORCEINLINE void AwareLock::RecordSpinSucceeded()
+{
+    WRAPPER_NO_CONTRACT;
+
+    // Updates are racy, but the spin count is only a heuristic and stays within bounds
+    DWORD spinCount = VolatileLoadWithoutBarrier(&m_spinCount);
+    DWORD maximumSpinCount = g_SpinConstants.dwMonitorSpinCount;
+    if (spinCount < maximumSpinCount)
+    {
+        m_spinCount = min(spinCount + SpinCountIncrement, maximumSpinCount);
+    }
+}
+
+FORCEINLINE void AwareLock::RecordSpinFailed()
+{
+    WRAPPER_NO_CONTRACT;
+
+    // When several threads spin on a lock, typically one of them gets it and the others give up while the new owner
+    // holds it. Count only the first spinner that gives up during each hold, so that the number of contending threads
+    // does not drive the spin count down on locks that are held only briefly.
+    DWORD holdCount = VolatileLoadWithoutBarrier(&m_holdCount);
+    if (m_HoldingThread == NULL || holdCount == m_spinFailureHoldCount)
+    {
+        return;
+    }
+    m_spinFailureHoldCount = holdCount;
+
+    // Back off by a quarter of the current spin count so that a lock that is consistently held for long periods quickly
+    // stops being spun on, while the occasional failure on a lock that is usually acquired by spinning does not matter much
+    DWORD spinCount = VolatileLoadWithoutBarrier(&m_spinCount);
+    if (spinCount > MinimumSpinCount)
+    {
+        DWORD decrement = max(spinCount / 4, (DWORD)1);
+        spinCount -= decrement;
+        m_spinCount = spinCount > MinimumSpinCount ? spinCount : (DWORD)MinimumSpinCount;
+    }
+}
+
 FORCEINLINE void AwareLock::SpinWait(const YieldProcessorNormalizationInfo &normalizationInfo, DWORD spinIteration)
 {
     WRAPPER_NO_CONTRACT;
@@ -479,6 +523,7 @@ FORCEINLINE bool AwareLock::TryEnterHelper(Thread* pCurThread)
     if (m_lockState.InterlockedTryLock())
     {
         m_HoldingThread = pCurThread;
+        m_holdCount++;
         m_Recursion = 1;
         pCurThread->IncLockCount();
         return true;
@@ -525,6 +570,7 @@ FORCEINLINE AwareLock::EnterHelperResult AwareLock::TryEnterBeforeSpinLoopHelper
 
         // Lock was acquired and the spinner was not registered
         m_HoldingThread = pCurThread;
+        m_holdCount++;
         m_Recursion = 1;
         pCurThread->IncLockCount();
         return EnterHelperResult_Entered;
@@ -557,6 +603,7 @@ FORCEINLINE AwareLock::EnterHelperResult AwareLock::TryEnterInsideSpinLoopHelper
 
     // Lock was acquired and spinner was unregistered
     m_HoldingThread = pCurThread;
+    m_holdCount++;
     m_Recursion = 1;
     pCurThread->IncLockCount();
     return EnterHelperResult_Entered;
@@ -580,6 +627,7 @@ FORCEINLINE bool AwareLock::TryEnterAfterSpinLoopHelper(Thread *pCurThread)
 
     // Spinner was unregistered and the lock was acquired
     m_HoldingThread = pCurThread;
+    m_holdCount++;
     m_Recursion = 1;
     pCurThread->IncLockCount();
     return true;
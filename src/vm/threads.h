@@ -232,7 +232,7 @@ public:
 
     void SetModuleSlot(ModuleIndex index, PTR_ThreadLocalModule pLocalModule);
 
-    PTR_ThreadLocalModule GetTLMIfExists(ModuleIndex index);
+    inline PTR_ThreadLocalModule GetTLMIfExists(ModuleIndex index);
     PTR_ThreadLocalModule GetTLMIfExists(MethodTable* pMT);
 
 #ifdef DACCESS_COMPILE
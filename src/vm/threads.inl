@@ -20,6 +20,7 @@
 #include "threads.h"
 #include "appdomain.hpp"
 #include "frames.h"
+#include "threadstatics.h"
 
 #ifndef DACCESS_COMPILE
 
@@ -41,6 +42,17 @@ EXTERN_C inline AppDomain* STDCALL GetAppDomain()
 
 #endif // !DACCESS_COMPILE
 
+inline PTR_ThreadLocalModule ThreadLocalBlock::GetTLMIfExists(ModuleIndex index)
+{
+    WRAPPER_NO_CONTRACT;
+    SUPPORTS_DAC;
+
+    if (index.m_dwIndex >= m_TLMTableSize)
+        return NULL;
+
+    return m_pTLMTable[index.m_dwIndex].pTLM;
+}
+
 inline void Thread::IncLockCount()
 {
     LIMITED_METHOD_CONTRACT;
@@ -59,6 +59,10 @@ extern "C" void             RedirectedHandledJITCaseForGCStress_Stub(void);
 // our chances of snagging it at a safe spot).
 #define PING_JIT_TIMEOUT        10
 
+// The first rendezvous wait of a suspension only lasts MIN_PING_JIT_TIMEOUT ms;
+// each wait that times out doubles it, up to PING_JIT_TIMEOUT.
+#define MIN_PING_JIT_TIMEOUT    1
+
 // When we find a thread in a spot that's not safe to abort -- how long to wait before
 // we try again.
 #define ABORT_POLL_TIMEOUT      10
@@ -4091,6 +4095,9 @@ HRESULT ThreadSuspend::SuspendRuntime(ThreadSuspend::SUSPEND_REASON reason)
 
 #endif
 
+    // How long to wait for a rendezvous before retrying hijacking/redirection.
+    DWORD pingTimeout = MIN_PING_JIT_TIMEOUT;
+
     //
     // Now we keep retrying until we find that no threads are in cooperative mode.  This should be merged into
     // the first loop.
@@ -4178,17 +4185,14 @@ HRESULT ThreadSuspend::SuspendRuntime(ThreadSuspend::SUSPEND_REASON reason)
         // return from the method we hijacked (maybe it calls into some other managed code that
         // executes a long loop, for example).  We we wait with a timeout, and retry hijacking/redirection.
         //
-        // This is unfortunate, because it means that in some cases we wait for PING_JIT_TIMEOUT
-        // milliseconds, causing long GC pause times.
-        //
-        // We should fix this, by calling SwitchToThread/Sleep(0) a few times before waiting on the event.
-        // This will not fix it 100% of the time (we may still have to wait on the event), but
-        // the event is needed to work around limitations of SwitchToThread/Sleep(0).
-        //
-        // For now, we simply wait.
+        // This is unfortunate, because it means that in some cases we wait for the full timeout,
+        // causing long GC pause times. To limit this, the first wait is short, so that a thread whose
+        // hijack or activation missed gets another one quickly; the timeout then backs off towards
+        // PING_JIT_TIMEOUT so that threads that are merely slow to reach a safe point are not pinged
+        // over and over.
         //
 
-        res = g_pGCSuspendEvent->Wait(PING_JIT_TIMEOUT, FALSE);
+        res = g_pGCSuspendEvent->Wait(pingTimeout, FALSE);
 
 
 #ifdef TIME_SUSPEND
@@ -4204,6 +4208,8 @@ HRESULT ThreadSuspend::SuspendRuntime(ThreadSuspend::SUSPEND_REASON reason)
         if (res == WAIT_TIMEOUT || res == WAIT_IO_COMPLETION)
         {
             STRESS_LOG1(LF_SYNC, LL_INFO1000, "    Timed out waiting for rendezvous event %d threads remaining\n", countThreads);
+
+            pingTimeout = min(pingTimeout * 2, (DWORD)PING_JIT_TIMEOUT);
 #ifdef _DEBUG
             DWORD dbgEndTimeout = GetTickCount();
 
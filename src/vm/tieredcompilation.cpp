@@ -38,11 +38,14 @@
 //
 // Methods initially call into OnMethodCalled() and once the call count exceeds
 // a fixed limit we queue work on to our internal list of methods needing to
-// be recompiled (m_methodsToOptimize). If there is currently no thread
-// servicing our queue asynchronously then we use the runtime threadpool
+// be recompiled (m_methodsToOptimize). If there are fewer threads servicing
+// our queue asynchronously than the configured limit (TC_BackgroundWorkerCount)
+// and than the number of queued methods then we use the runtime threadpool
 // QueueUserWorkItem to recruit one. During the callback for each threadpool work
 // item we handle as many methods as possible in a fixed period of time, then
 // queue another threadpool work item if m_methodsToOptimize hasn't been drained.
+// Additional workers back off when the processors are saturated, so that
+// background jitting does not compete with the application.
 //
 // The background thread enters at StaticOptimizeMethodsCallback(), enters the
 // appdomain, and then begins calling OptimizeMethod on each method in the
@@ -524,6 +527,10 @@ void TieredCompilationManager::TieringDelayTimerCallbackWorker()
 
     ThreadpoolMgr::DeleteTimerQueueTimer(tieringDelayTimerHandle, nullptr);
 
+    // Methods that were promoted during the delay have all been queued at once, so bring in additional workers to help drain
+    // the backlog
+    RecruitAdditionalWorkersIfNeeded();
+
     if (optimizeMethods)
     {
         OptimizeMethods();
@@ -563,6 +570,32 @@ bool TieredCompilationManager::TryAsyncOptimizeMethods()
     return success;
 }
 
+// Queues additional background workers while IncrementWorkerThreadCountIfNeeded allows. Methods are normally queued one at a
+// time as they are promoted, and each one gives a chance to recruit a worker, but a backlog can also be left behind by the
+// tiering delay or by a worker that requeues itself after its quantum.
+void TieredCompilationManager::RecruitAdditionalWorkersIfNeeded()
+{
+    WRAPPER_NO_CONTRACT;
+
+    while (true)
+    {
+        {
+            CrstHolder holder(&m_lock);
+            if (!IncrementWorkerThreadCountIfNeeded())
+            {
+                return;
+            }
+        }
+
+        if (!TryAsyncOptimizeMethods())
+        {
+            CrstHolder holder(&m_lock);
+            DecrementWorkerThreadCount();
+            return;
+        }
+    }
+}
+
 // This is the initial entrypoint for the background thread, called by
 // the threadpool.
 DWORD WINAPI TieredCompilationManager::StaticOptimizeMethodsCallback(void *args)
@@ -659,11 +692,26 @@ void TieredCompilationManager::OptimizeMethods()
             DWORD currentTickCount = GetTickCount();
             if (currentTickCount - startTickCount >= OptimizationQuantumMs)
             {
+                {
+                    // If other workers are running and the processors are saturated, retire this worker instead of
+                    // continuing to compete with the application. The last worker continues draining the queue.
+                    CrstHolder holder(&m_lock);
+                    if (m_countOptimizationThreadsRunning > 1 && IsProcessorUsageSaturated())
+                    {
+                        DecrementWorkerThreadCount();
+                        break;
+                    }
+                }
+
                 if (!TryAsyncOptimizeMethods())
                 {
                     CrstHolder holder(&m_lock);
                     DecrementWorkerThreadCount();
                 }
+                else
+                {
+                    RecruitAdditionalWorkersIfNeeded();
+                }
                 break;
             }
         }
@@ -828,13 +876,18 @@ bool TieredCompilationManager::IncrementWorkerThreadCountIfNeeded()
     WRAPPER_NO_CONTRACT;
     // m_lock should be held
 
-    if (0 == m_countOptimizationThreadsRunning &&
+    if (m_countOptimizationThreadsRunning < g_pConfig->TieredCompilation_BackgroundWorkerCount() &&
+        m_countOptimizationThreadsRunning < m_countOfMethodsToOptimize &&
         !m_isAppDomainShuttingDown &&
         !m_methodsToOptimize.IsEmpty() &&
         !IsTieringDelayActive())
     {
-        // Our current policy throttles at 1 thread, but in the future we
-        // could experiment with more parallelism.
+        // Always allow one worker, but only add more while there is spare processor capacity
+        if (m_countOptimizationThreadsRunning != 0 && IsProcessorUsageSaturated())
+        {
+            return false;
+        }
+
         m_countOptimizationThreadsRunning++;
         return true;
     }
@@ -850,6 +903,15 @@ void TieredCompilationManager::DecrementWorkerThreadCount()
     m_countOptimizationThreadsRunning--;
 }
 
+// static
+bool TieredCompilationManager::IsProcessorUsageSaturated()
+{
+    WRAPPER_NO_CONTRACT;
+
+    // The thread pool's gate thread periodically samples the processor utilization of the process
+    return ThreadpoolMgr::GetCPUUtilization() > CpuUtilizationHigh;
+}
+
 #ifdef _DEBUG
 DWORD TieredCompilationManager::DebugGetWorkerThreadCount()
 {
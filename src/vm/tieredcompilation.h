@@ -48,6 +48,7 @@ private:
     void TieringDelayTimerCallbackWorker();
 
     bool TryAsyncOptimizeMethods();
+    void RecruitAdditionalWorkersIfNeeded();
     static DWORD StaticOptimizeMethodsCallback(void* args);
     void OptimizeMethodsCallback();
     void OptimizeMethods();
@@ -58,6 +59,7 @@ private:
 
     bool IncrementWorkerThreadCountIfNeeded();
     void DecrementWorkerThreadCount();
+    static bool IsProcessorUsageSaturated();
 #ifdef _DEBUG
     DWORD DebugGetWorkerThreadCount();
 #endif
@@ -146,6 +146,13 @@ DWORD EETypeHashTable::GetCount()
     return BaseGetElementCount();
 }
 
+DWORD EETypeHashTable::GetResizeCount()
+{
+    LIMITED_METHOD_DAC_CONTRACT;
+
+    return BaseGetResizeCount();
+}
+
 static DWORD HashTypeHandle(DWORD level, TypeHandle t);
 
 // Calculate hash value for a type def or instantiated type def
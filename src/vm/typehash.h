@@ -142,6 +142,10 @@ public:
 
     DWORD GetCount();
 
+    // Bumped before and after every resize of the table; lets a lock-free miss from GetValue decide whether
+    // it raced with a resize and needs to be retried under the lock.
+    DWORD GetResizeCount();
+
 #if defined(FEATURE_PREJIT) && !defined(DACCESS_COMPILE)
     // Save the hash table and any type descriptors referenced by it
     // Template method tables (for arrays) must be saved separately
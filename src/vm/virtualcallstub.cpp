@@ -1514,8 +1514,7 @@ size_t VirtualCallStubManager::GetTokenFromStubQuick(VirtualCallStubManager * pM
     if (kind == SK_DISPATCH)
     {
         _ASSERTE(pMgr->isDispatchingStub(stub));
-        DispatchStub  * dispatchStub  = (DispatchStub *) PCODEToPINSTR(stub);
-        ResolveHolder * resolveHolder = ResolveHolder::FromFailEntry(dispatchStub->failTarget());
+        ResolveHolder * resolveHolder = pMgr->GetResolveHolderForDispatchStub(stub);
         _ASSERTE(pMgr->isResolvingStub(resolveHolder->stub()->resolveEntryPoint()));
         return resolveHolder->stub()->token();
     }
@@ -1636,10 +1635,22 @@ PCODE VSD_ResolveWorker(TransitionBlock * pTransitionBlock,
         {
             PCODE stubAddr = callSite.GetSiteTarget();
             VirtualCallStubManager * pMgr = VirtualCallStubManager::FindStubManager(stubAddr);
-            pMgr->BackPatchWorker(&callSite);
-        }
 
-        return target;
+            // If the call site can get a dispatch stub for this type instead, take the slow
+            // path below, which has the frame needed to generate the stub
+            if (!pMgr->CanGrowDispatchChain(stubAddr))
+            {
+                pMgr->BackPatchWorker(&callSite);
+                return target;
+            }
+
+            token = pElem->token;
+            target = NULL;
+        }
+        else
+        {
+            return target;
+        }
     }
 #endif
 
@@ -1672,15 +1683,24 @@ PCODE VSD_ResolveWorker(TransitionBlock * pTransitionBlock,
     VirtualCallStubManager *pMgr = VirtualCallStubManager::FindStubManager(callSiteTarget, &stubKind);
     PREFIX_ASSUME(pMgr != NULL);
 
+    BOOL fGrowDispatchChain = FALSE;
+
 #ifndef _TARGET_X86_
-    // Have we failed the dispatch stub too many times?
+    // Have we failed the dispatch stub too many times? If the call site has only seen a
+    // few types, ResolveWorker gives it a dispatch stub for this type as well, otherwise
+    // the call site is patched to the resolve stub.
     if (flags & SDF_ResolveBackPatch)
     {
-        pMgr->BackPatchWorker(&callSite);
+        fGrowDispatchChain = (stubKind == VirtualCallStubManager::SK_DISPATCH) &&
+                             pMgr->CanGrowDispatchChain(callSiteTarget);
+        if (!fGrowDispatchChain)
+        {
+            pMgr->BackPatchWorker(&callSite);
+        }
     }
 #endif
 
-    target = pMgr->ResolveWorker(&callSite, protectedObj, representativeToken, stubKind);
+    target = pMgr->ResolveWorker(&callSite, protectedObj, representativeToken, stubKind, fGrowDispatchChain);
 
     GCPROTECT_END();
 
@@ -1726,7 +1746,8 @@ void BackPatchWorkerStaticStub(PCODE returnAddr, TADDR siteAddrForRegisterIndire
 PCODE VirtualCallStubManager::ResolveWorker(StubCallSite* pCallSite,
                                             OBJECTREF *protectedObj,
                                             DispatchToken token,
-                                            StubKind stubKind)
+                                            StubKind stubKind,
+                                            BOOL fGrowDispatchChain)
 {
     CONTRACTL {
         THROWS;
@@ -1736,6 +1757,7 @@ PCODE VirtualCallStubManager::ResolveWorker(StubCallSite* pCallSite,
         PRECONDITION(protectedObj != NULL);
         PRECONDITION(*protectedObj != NULL);
         PRECONDITION(IsProtectedByGCFrame(protectedObj));
+        PRECONDITION(!fGrowDispatchChain || stubKind == SK_DISPATCH);
     } CONTRACTL_END;
 
     MethodTable* objectType = (*protectedObj)->GetMethodTable();
@@ -1812,6 +1834,7 @@ PCODE VirtualCallStubManager::ResolveWorker(StubCallSite* pCallSite,
     PCODE stub = CALL_STUB_EMPTY_ENTRY;
     PCODE target = NULL;
     BOOL patch = FALSE;
+    BOOL fGrewDispatchChain = FALSE;
 
     // This code can throw an OOM, but we do not want to fail in this case because
     // we must always successfully determine the target of a virtual call so that
@@ -2146,12 +2169,23 @@ PCODE VirtualCallStubManager::ResolveWorker(StubCallSite* pCallSite,
                 BackPatchSite(pCallSite, (PCODE)stub);
             }
         }
+
+        if (fGrowDispatchChain && patch && bCreateDispatchStub)
+        {
+            fGrewDispatchChain = GrowDispatchChain(pCallSite, objectType, token, target);
+        }
     }
     EX_CATCH
     {
     }
     EX_END_CATCH (SwallowAllExceptions);
 
+    // If the call site could not get a dispatch stub for this type, make it polymorphic
+    if (fGrowDispatchChain && !fGrewDispatchChain)
+    {
+        BackPatchWorker(pCallSite);
+    }
+
     // Target can be NULL only if we can't resolve to an address
     _ASSERTE(target != NULL);
 
@@ -2644,14 +2678,13 @@ void VirtualCallStubManager::BackPatchWorker(StubCallSite* pCallSite)
     if (isDispatchingStub(callSiteTarget))
     {
         DispatchHolder * dispatchHolder = DispatchHolder::FromDispatchEntry(callSiteTarget);
-        DispatchStub *   dispatchStub   = dispatchHolder->stub();
 
         //yes, patch it to point to the resolve stub
         //We can ignore the races now since we now know that the call site does go thru our
         //stub mechanisms, hence no matter who wins the race, we are correct.
         //We find the correct resolve stub by following the failure path in the dispatcher stub itself
-        PCODE failEntry    = dispatchStub->failTarget();
-        ResolveStub* resolveStub  = ResolveHolder::FromFailEntry(failEntry)->stub();
+        //(through any other dispatch stubs the call site checks)
+        ResolveStub* resolveStub  = GetResolveHolderForDispatchStub(callSiteTarget)->stub();
         PCODE resolveEntry = resolveStub->resolveEntryPoint();
         BackPatchSite(pCallSite, resolveEntry);
 
@@ -2694,12 +2727,14 @@ void VirtualCallStubManager::BackPatchSite(StubCallSite* pCallSite, PCODE stub)
     //  prior           new
     //  lookup          dispatching or resolving
     //  dispatching     resolving
+    //  dispatching     dispatching that fails over to prior (see GrowDispatchChain)
     if (isResolvingStub(prior))
         return;
 
     if(isDispatchingStub(stub))
     {
-        if(isDispatchingStub(prior))
+        if(isDispatchingStub(prior) &&
+           DispatchHolder::FromDispatchEntry(stub)->stub()->failTarget() != prior)
         {
             return;
         }
@@ -2727,6 +2762,113 @@ void StubCallSite::SetSiteTarget(PCODE newTarget)
     *pCell = newTarget;
 }
 
+//----------------------------------------------------------------------------
+/* A call site that sees a few types gets a chain of dispatch stubs, each failing over to
+the next one, with the last one failing over to the resolve stub for the token. Return the
+number of dispatch stubs in the chain starting at stub.
+*/
+UINT32 VirtualCallStubManager::GetDispatchChainLength(PCODE stub)
+{
+    CONTRACTL {
+        NOTHROW;
+        GC_NOTRIGGER;
+        FORBID_FAULT;
+    } CONTRACTL_END
+
+    UINT32 length = 0;
+    while (isDispatchingStub(stub))
+    {
+        length++;
+        stub = DispatchHolder::FromDispatchEntry(stub)->stub()->failTarget();
+    }
+    return length;
+}
+
+//----------------------------------------------------------------------------
+ResolveHolder *VirtualCallStubManager::GetResolveHolderForDispatchStub(PCODE dispatchEntry)
+{
+    CONTRACTL {
+        NOTHROW;
+        GC_NOTRIGGER;
+        FORBID_FAULT;
+        PRECONDITION(isDispatchingStub(dispatchEntry));
+    } CONTRACTL_END
+
+    PCODE failTarget = dispatchEntry;
+    while (isDispatchingStub(failTarget))
+    {
+        failTarget = DispatchHolder::FromDispatchEntry(failTarget)->stub()->failTarget();
+    }
+    return ResolveHolder::FromFailEntry(failTarget);
+}
+
+//----------------------------------------------------------------------------
+BOOL VirtualCallStubManager::CanGrowDispatchChain(PCODE siteTarget)
+{
+    CONTRACTL {
+        NOTHROW;
+        GC_NOTRIGGER;
+        FORBID_FAULT;
+    } CONTRACTL_END
+
+    if (!isDispatchingStub(siteTarget))
+        return FALSE;
+
+    return GetDispatchChainLength(siteTarget) < CALL_STUB_MAX_DISPATCH_CHAIN;
+}
+
+//----------------------------------------------------------------------------
+/* The call site keeps missing its dispatch stubs. Rather than making it polymorphic right
+away, put a dispatch stub for objectType in front of the ones it already has, as long as
+the chain stays short. Returns FALSE if the call site is left as it was.
+*/
+BOOL VirtualCallStubManager::GrowDispatchChain(StubCallSite* pCallSite,
+                                               MethodTable*  objectType,
+                                               DispatchToken token,
+                                               PCODE         target)
+{
+    CONTRACTL {
+        THROWS;
+        GC_TRIGGERS;
+        INJECT_FAULT(COMPlusThrowOM(););
+        PRECONDITION(CheckPointer(pCallSite));
+        PRECONDITION(CheckPointer(objectType));
+        PRECONDITION(target != NULL);
+    } CONTRACTL_END
+
+    PCODE prior = pCallSite->GetSiteTarget();
+    if (!CanGrowDispatchChain(prior))
+        return FALSE;
+
+    // Nothing to do if one of the dispatch stubs already checks for this type (another
+    // thread got here first)
+    for (PCODE stub = prior; isDispatchingStub(stub); )
+    {
+        DispatchStub * dispatchStub = DispatchHolder::FromDispatchEntry(stub)->stub();
+        if (dispatchStub->expectedMT() == (size_t)objectType)
+            return FALSE;
+        stub = dispatchStub->failTarget();
+    }
+
+    // The new stub fails over to this particular call site's dispatch stubs, so unlike the
+    // stubs created in ResolveWorker it cannot be shared through the dispatchers table
+    bool reenteredCooperativeGCMode = false;
+    DispatchHolder *pDispatchHolder = GenerateDispatchStub(
+        target, prior, objectType, token.To_SIZE_T(), &reenteredCooperativeGCMode);
+
+    BackPatchSite(pCallSite, pDispatchHolder->stub()->entryPoint());
+
+    LOG((LF_STUBS, LL_INFO10000, "GrowDispatchChain call-site" FMT_ADDR "dispatchStub" FMT_ADDR "\n",
+         DBG_ADDR(pCallSite->GetReturnAddress()), DBG_ADDR(pDispatchHolder->stub())));
+
+    //Add back the default miss count to the counter being used by the resolve stub,
+    //as BackPatchWorker would have
+    INT32* counter = GetResolveHolderForDispatchStub(pDispatchHolder->stub()->entryPoint())->stub()->pCounter();
+    *counter += STUB_MISS_COUNT_VALUE;
+
+    return TRUE;
+}
+
 //----------------------------------------------------------------------------
 /* Generate a dispatcher stub, pMTExpected is the method table to burn in the stub, and the two addrOf's
 are the addresses the stub is to transfer to depending on the test with pMTExpected
@@ -604,12 +604,19 @@ private:
     static void STDCALL BackPatchWorkerStatic(PCODE returnAddr, TADDR siteAddrForRegisterIndirect);
 
 public:
-    PCODE ResolveWorker(StubCallSite* pCallSite, OBJECTREF *protectedObj, DispatchToken token, StubKind stubKind);
+    PCODE ResolveWorker(StubCallSite* pCallSite, OBJECTREF *protectedObj, DispatchToken token, StubKind stubKind,
+                        BOOL fGrowDispatchChain = FALSE);
     void BackPatchWorker(StubCallSite* pCallSite);
 
     //Change the callsite to point to stub
     void BackPatchSite(StubCallSite* pCallSite, PCODE stub);
 
+    //Support for call sites that check for a few types with a chain of dispatch stubs
+    BOOL CanGrowDispatchChain(PCODE siteTarget);
+    BOOL GrowDispatchChain(StubCallSite* pCallSite, MethodTable* objectType, DispatchToken token, PCODE target);
+    UINT32 GetDispatchChainLength(PCODE stub);
+    ResolveHolder *GetResolveHolderForDispatchStub(PCODE dispatchEntry);
+
 public:
     /* the following two public functions are to support tracing or stepping thru
     stubs via the debugger. */
@@ -1032,6 +1039,8 @@ extern UINT32 STUB_COLLIDE_MONO_PCT;
 #define CALL_STUB_EMPTY_ENTRY   0
 // number of successes for a chained element before it gets moved to the front
 #define CALL_STUB_CACHE_INITIAL_SUCCESS_COUNT (0x100)
+// max number of dispatch stubs (types checked inline) at a call site before it goes polymorphic
+#define CALL_STUB_MAX_DISPATCH_CHAIN 4
 
 /*******************************************************************************************************
 Entry is an abstract class.  We will make specific subclasses for each kind of
@@ -246,6 +246,12 @@ public:
 
     static INT32 GetThreadCount();
 
+    inline static LONG GetCPUUtilization()
+    {
+        LIMITED_METHOD_CONTRACT;
+        return cpuUtilization;
+    }
+
     static BOOL QueueUserWorkItem(LPTHREAD_START_ROUTINE Function,
                                   PVOID Context,
                                   ULONG Flags,
@@ -0,0 +1,151 @@
+// Licensed to the .NET Foundation under one or more agreements.
+// The .NET Foundation licenses this file to you under the MIT license.
+// See the LICENSE file in the project root for more information.
+
+// Unrolled block init/copy on xarch finishes sizes that are not a multiple of
+// 16 with an overlapping SSE2 store of the last 16 bytes. Exercise sizes around
+// that boundary for both struct locals and stackalloc'd buffers, with a
+// non-zero fill, and make sure the bytes just past the block are untouched.
+
+using System;
+using System.Runtime.CompilerServices;
+
+unsafe struct S16 { public fixed byte Data[16]; }
+unsafe struct S17 { public fixed byte Data[17]; }
+unsafe struct S24 { public fixed byte Data[24]; }
+unsafe struct S31 { public fixed byte Data[31]; }
+unsafe struct S33 { public fixed byte Data[33]; }
+unsafe struct S47 { public fixed byte Data[47]; }
+unsafe struct S63 { public fixed byte Data[63]; }
+
+// The guard immediately follows the value since both are byte-aligned.
+struct Guarded<T> where T : struct
+{
+    public T Value;
+    public S16 Guard;
+}
+
+unsafe public class BlockInitCopyRemainder
+{
+    const byte Fill = 0xA5;
+    const byte GuardFill = 0x3C;
+    const int GuardSize = 16;
+
+    static int s_failures;
+
+    [MethodImpl(MethodImplOptions.NoInlining)]
+    static void InitStruct<T>(ref T value) where T : struct
+    {
+        Unsafe.InitBlockUnaligned(ref Unsafe.As<T, byte>(ref value), Fill, (uint)Unsafe.SizeOf<T>());
+    }
+
+    [MethodImpl(MethodImplOptions.NoInlining)]
+    static void CopyStruct<T>(ref T destination, ref T source) where T : struct
+    {
+        destination = source;
+    }
+
+    [MethodImpl(MethodImplOptions.NoInlining)]
+    static void ZeroStruct<T>(ref T value) where T : struct
+    {
+        value = default(T);
+    }
+
+    static void Check(string what, byte* p, int size, Func<int, byte> expected)
+    {
+        for (int i = 0; i < size; i++)
+        {
+            if (p[i] != expected(i))
+            {
+                Console.WriteLine($"FAILED: {what} size {size}: byte {i} is 0x{p[i]:X2}, expected 0x{expected(i):X2}");
+                s_failures++;
+                return;
+            }
+        }
+
+        for (int i = 0; i < GuardSize; i++)
+        {
+            if (p[size + i] != GuardFill)
+            {
+                Console.WriteLine($"FAILED: {what} size {size}: guard byte {i} past the end is 0x{p[size + i]:X2}");
+                s_failures++;
+                return;
+            }
+        }
+    }
+
+    static byte Pattern(int i) => (byte)(i * 7 + 1);
+
+    static void TestStruct<T>() where T : struct
+    {
+        int size = Unsafe.SizeOf<T>();
+        Guarded<T> destination = default(Guarded<T>);
+        Guarded<T> source = default(Guarded<T>);
+        byte* d = (byte*)Unsafe.AsPointer(ref destination);
+        byte* s = (byte*)Unsafe.AsPointer(ref source);
+
+        for (int i = 0; i < size + GuardSize; i++)
+        {
+            d[i] = GuardFill;
+            s[i] = (i < size) ? Pattern(i) : (byte)0;
+        }
+
+        InitStruct(ref destination.Value);
+        Check("struct init", d, size, i => Fill);
+
+        CopyStruct(ref destination.Value, ref source.Value);
+        Check("struct copy", d, size, Pattern);
+
+        ZeroStruct(ref destination.Value);
+        Check("struct zero", d, size, i => 0);
+    }
+
+    [MethodImpl(MethodImplOptions.NoInlining)]
+    static void TestStackalloc<T>() where T : struct
+    {
+        int size = Unsafe.SizeOf<T>();
+        byte* destination = stackalloc byte[Unsafe.SizeOf<T>() + GuardSize];
+        byte* source = stackalloc byte[Unsafe.SizeOf<T>() + GuardSize];
+
+        for (int i = 0; i < size + GuardSize; i++)
+        {
+            destination[i] = GuardFill;
+            source[i] = (i < size) ? Pattern(i) : (byte)0;
+        }
+
+        Unsafe.InitBlockUnaligned(destination, Fill, (uint)Unsafe.SizeOf<T>());
+        Check("stackalloc init", destination, size, i => Fill);
+
+        Unsafe.CopyBlockUnaligned(destination, source, (uint)Unsafe.SizeOf<T>());
+        Check("stackalloc copy", destination, size, Pattern);
+
+        Unsafe.Write(destination, default(T));
+        Check("stackalloc zero", destination, size, i => 0);
+    }
+
+    static void Test<T>() where T : struct
+    {
+        TestStruct<T>();
+        TestStackalloc<T>();
+    }
+
+    public static int Main()
+    {
+        Test<S16>();
+        Test<S17>();
+        Test<S24>();
+        Test<S31>();
+        Test<S33>();
+        Test<S47>();
+        Test<S63>();
+
+        if (s_failures != 0)
+        {
+            Console.WriteLine($"FAILED: {s_failures} failures");
+            return -1;
+        }
+
+        Console.WriteLine("PASSED");
+        return 100;
+    }
+}
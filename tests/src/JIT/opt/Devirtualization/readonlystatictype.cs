@@ -0,0 +1,81 @@
+// Licensed to the .NET Foundation under one or more agreements.
+// The .NET Foundation licenses this file to you under the MIT license.
+// See the LICENSE file in the project root for more information.
+
+using System;
+using System.Runtime.CompilerServices;
+
+class B
+{
+}
+
+class D : B
+{
+}
+
+class X
+{
+    static readonly B S;
+    static readonly B N;
+    static bool R;
+
+    static X()
+    {
+        S = new B();
+        R = During();
+        S = new D();
+        N = null;
+    }
+
+    [MethodImpl(MethodImplOptions.NoInlining)]
+    static bool During()
+    {
+        // Jit should not be able to fold this type check here
+        return S.GetType() == typeof(B);
+    }
+
+    [MethodImpl(MethodImplOptions.NoInlining)]
+    static bool After()
+    {
+        // Jit should be able to fold this type check here
+        return S.GetType() == typeof(D);
+    }
+
+    [MethodImpl(MethodImplOptions.NoInlining)]
+    static bool AfterNotEqual()
+    {
+        // Jit should be able to fold this type check here
+        return S.GetType() != typeof(B);
+    }
+
+    [MethodImpl(MethodImplOptions.NoInlining)]
+    static bool AfterNull()
+    {
+        // Jit must preserve the null reference exception here
+        return N.GetType() == typeof(B);
+    }
+
+    public static int Main()
+    {
+        bool after = After();
+        bool afterNotEqual = AfterNotEqual();
+        bool threw = false;
+
+        try
+        {
+            AfterNull();
+        }
+        catch (NullReferenceException)
+        {
+            threw = true;
+        }
+
+        if (R && after && afterNotEqual && threw)
+        {
+            return 100;
+        }
+
+        Console.WriteLine($"During: {R}, After: {after}, AfterNotEqual: {afterNotEqual}, Threw: {threw}");
+        return -1;
+    }
+}
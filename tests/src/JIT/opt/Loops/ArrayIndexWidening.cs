@@ -0,0 +1,119 @@
+// Licensed to the .NET Foundation under one or more agreements.
+// The .NET Foundation licenses this file to you under the MIT license.
+// See the LICENSE file in the project root for more information.
+
+// Test for widening of range checked array indices in loops.
+
+using System;
+using System.Runtime.CompilerServices;
+
+namespace N
+{
+    public static class C
+    {
+        [MethodImpl(MethodImplOptions.NoInlining)]
+        static long SumForward(int[] a)
+        {
+            long sum = 0;
+            for (int i = 0; i < a.Length; i++)
+            {
+                sum += a[i];
+            }
+
+            return sum;
+        }
+
+        [MethodImpl(MethodImplOptions.NoInlining)]
+        static long SumReverse(long[] a)
+        {
+            long sum = 0;
+            for (int i = a.Length - 1; i >= 0; i--)
+            {
+                sum += a[i];
+            }
+
+            return sum;
+        }
+
+        [MethodImpl(MethodImplOptions.NoInlining)]
+        static int SumStrided(short[] a, int start, int stride)
+        {
+            int sum = 0;
+            for (int i = start; i < a.Length; i += stride)
+            {
+                sum += a[i];
+            }
+
+            return sum;
+        }
+
+        [MethodImpl(MethodImplOptions.NoInlining)]
+        static int SumOffset(byte[] a, int offset)
+        {
+            int sum = 0;
+            for (int i = 0; i < 4; i++)
+            {
+                sum += a[i + offset];
+            }
+
+            return sum;
+        }
+
+        [MethodImpl(MethodImplOptions.NoInlining)]
+        static bool ThrowsForNegativeIndex(int[] a, int index)
+        {
+            try
+            {
+                return a[index] == -1;
+            }
+            catch (IndexOutOfRangeException)
+            {
+                return true;
+            }
+        }
+
+        public static int Main(string[] args)
+        {
+            int[] ints = new int[] { 1, 2, 3, 4, 5, 6, 7 };
+            long[] longs = new long[] { -1L, 0x100000000L, 3L };
+            short[] shorts = new short[] { 1, -2, 3, -4, 5, -6, 7 };
+            byte[] bytes = new byte[] { 10, 20, 30, 40, 50, 60 };
+
+            if (SumForward(ints) != 28)
+            {
+                return -1;
+            }
+
+            if (SumReverse(longs) != 0x100000002L)
+            {
+                return -1;
+            }
+
+            if ((SumStrided(shorts, 0, 2) != 16) || (SumStrided(shorts, 1, 3) != 3))
+            {
+                return -1;
+            }
+
+            if (SumOffset(bytes, 2) != 180)
+            {
+                return -1;
+            }
+
+            try
+            {
+                SumOffset(bytes, -1);
+                return -1;
+            }
+            catch (IndexOutOfRangeException)
+            {
+            }
+
+            if (!ThrowsForNegativeIndex(ints, -1) || !ThrowsForNegativeIndex(ints, int.MinValue))
+            {
+                return -1;
+            }
+
+            return 100;
+        }
+    }
+}
@@ -0,0 +1,94 @@
+// Licensed to the .NET Foundation under one or more agreements.
+// The .NET Foundation licenses this file to you under the MIT license.
+// See the LICENSE file in the project root for more information.
+
+// Test for range check elimination in loops with a constant stride.
+
+using System;
+using System.Runtime.CompilerServices;
+
+namespace N
+{
+    public static class C
+    {
+        [MethodImpl(MethodImplOptions.NoInlining)]
+        static int SumEveryOther(int[] a)
+        {
+            int sum = 0;
+            for (int i = 0; i < a.Length; i += 2)
+            {
+                sum += a[i];
+            }
+
+            return sum;
+        }
+
+        [MethodImpl(MethodImplOptions.NoInlining)]
+        static int SumEveryFourth(byte[] a)
+        {
+            int sum = 0;
+            for (int i = 1; i < a.Length; i += 4)
+            {
+                sum += a[i];
+            }
+
+            return sum;
+        }
+
+        [MethodImpl(MethodImplOptions.NoInlining)]
+        static int SumEveryFourthSpan(ReadOnlySpan<byte> a)
+        {
+            int sum = 0;
+            for (int i = 1; i < a.Length; i += 4)
+            {
+                sum += a[i];
+            }
+
+            return sum;
+        }
+
+        public static int Main(string[] args)
+        {
+            for (int length = 0; length < 12; length++)
+            {
+                int[] ints = new int[length];
+                byte[] bytes = new byte[length];
+                int expectedEveryOther = 0;
+                int expectedEveryFourth = 0;
+
+                for (int i = 0; i < length; i++)
+                {
+                    ints[i] = i + 1;
+                    bytes[i] = (byte)(i + 1);
+
+                    if ((i % 2) == 0)
+                    {
+                        expectedEveryOther += i + 1;
+                    }
+
+                    if ((i % 4) == 1)
+                    {
+                        expectedEveryFourth += i + 1;
+                    }
+                }
+
+                if (SumEveryOther(ints) != expectedEveryOther)
+                {
+                    return -1;
+                }
+
+                if (SumEveryFourth(bytes) != expectedEveryFourth)
+                {
+                    return -1;
+                }
+
+                if (SumEveryFourthSpan(bytes) != expectedEveryFourth)
+                {
+                    return -1;
+                }
+            }
+
+            return 100;
+        }
+    }
+}
@@ -0,0 +1,118 @@
+// Licensed to the .NET Foundation under one or more agreements.
+// The .NET Foundation licenses this file to you under the MIT license.
+// See the LICENSE file in the project root for more information.
+
+// Integer constants that are spilled by the register allocator are regenerated
+// at their use instead of being reloaded from a spill temp. Build wide
+// expressions where many large constants need registers (as the first operand
+// of a shift or subtraction, or as 64-bit values that do not fit an immediate)
+// while other values are live, so that some of them are spilled, and check the
+// results against the same expressions compiled without optimization.
+// The project restricts the allocator to a small register set to make spills
+// certain in checked builds.
+
+using System;
+using System.Runtime.CompilerServices;
+
+public class RematerializeConstants
+{
+    static int s_failures;
+
+    [MethodImpl(MethodImplOptions.NoInlining)]
+    static long ComputeLong(long a, long b, long c, long d, int s)
+    {
+        return (((0x123456789ABCDEF0L << s) - a) * ((0x0FEDCBA987654321L - b) ^ (0x7A5A5A5A5A5A5A5AL << s)) +
+                ((0x1111222233334444L - c) | (0x5555666677778888L << s)) * ((0x0102030405060708L - d) + b)) ^
+               (((0x7FFFFFFF00000001L - a) * (0x00000001FFFFFFFFL << s) + (0x6B6B6B6B6B6B6B6BL - c)) -
+                ((0x3C3C3C3C3C3C3C3CL << s) ^ d) * ((0x1234000000005678L - b) & (0x0ABCDEF012345678L | a)));
+    }
+
+    [MethodImpl(MethodImplOptions.NoInlining | MethodImplOptions.NoOptimization)]
+    static long ReferenceLong(long a, long b, long c, long d, int s)
+    {
+        return (((0x123456789ABCDEF0L << s) - a) * ((0x0FEDCBA987654321L - b) ^ (0x7A5A5A5A5A5A5A5AL << s)) +
+                ((0x1111222233334444L - c) | (0x5555666677778888L << s)) * ((0x0102030405060708L - d) + b)) ^
+               (((0x7FFFFFFF00000001L - a) * (0x00000001FFFFFFFFL << s) + (0x6B6B6B6B6B6B6B6BL - c)) -
+                ((0x3C3C3C3C3C3C3C3CL << s) ^ d) * ((0x1234000000005678L - b) & (0x0ABCDEF012345678L | a)));
+    }
+
+    [MethodImpl(MethodImplOptions.NoInlining)]
+    static int ComputeInt(int a, int b, int c, int d, int s)
+    {
+        return (((0x12345678 << s) - a) * ((0x0FEDCBA9 - b) ^ (0x7A5A5A5A << s)) +
+                ((0x11112222 - c) | (0x55556666 << s)) * ((0x01020304 - d) + b)) ^
+               (((0x7FFF0001 - a) * (0x0001FFFF << s) + (0x6B6B6B6B - c)) -
+                ((0x3C3C3C3C << s) ^ d) * ((0x12345678 - b) & (0x0ABCDEF0 | a)));
+    }
+
+    [MethodImpl(MethodImplOptions.NoInlining | MethodImplOptions.NoOptimization)]
+    static int ReferenceInt(int a, int b, int c, int d, int s)
+    {
+        return (((0x12345678 << s) - a) * ((0x0FEDCBA9 - b) ^ (0x7A5A5A5A << s)) +
+                ((0x11112222 - c) | (0x55556666 << s)) * ((0x01020304 - d) + b)) ^
+               (((0x7FFF0001 - a) * (0x0001FFFF << s) + (0x6B6B6B6B - c)) -
+                ((0x3C3C3C3C << s) ^ d) * ((0x12345678 - b) & (0x0ABCDEF0 | a)));
+    }
+
+    // Keeps all of the arguments and a large constant live across each call, so
+    // that the constant has to survive in a callee saved register or be spilled.
+    [MethodImpl(MethodImplOptions.NoInlining)]
+    static long Identity(long x) => x;
+
+    [MethodImpl(MethodImplOptions.NoInlining)]
+    static long ComputeAcrossCalls(long a, long b, long c, long d)
+    {
+        long x = (0x0123456789ABCDEFL - a) + Identity(b) * (0x7EDCBA9876543210L - c) + Identity(d);
+        long y = (0x3333444455556666L - b) ^ Identity(a + c) ^ (0x0F0F0F0F0F0F0F0FL - d) ^ Identity(x);
+        return x * y + (0x2222111144443333L - x) * Identity(y) + a + b + c + d;
+    }
+
+    [MethodImpl(MethodImplOptions.NoInlining | MethodImplOptions.NoOptimization)]
+    static long ReferenceAcrossCalls(long a, long b, long c, long d)
+    {
+        long x = (0x0123456789ABCDEFL - a) + Identity(b) * (0x7EDCBA9876543210L - c) + Identity(d);
+        long y = (0x3333444455556666L - b) ^ Identity(a + c) ^ (0x0F0F0F0F0F0F0F0FL - d) ^ Identity(x);
+        return x * y + (0x2222111144443333L - x) * Identity(y) + a + b + c + d;
+    }
+
+    static void Check<T>(string what, T actual, T expected)
+    {
+        if (!actual.Equals(expected))
+        {
+            Console.WriteLine($"FAILED: {what}: got 0x{actual:X}, expected 0x{expected:X}");
+            s_failures++;
+        }
+    }
+
+    public static int Main()
+    {
+        long[] values = { 0, 1, -1, 0x7FFFFFFF, unchecked((long)0x8000000000000000UL), 0x0123456789ABCDEFL };
+
+        foreach (long a in values)
+        {
+            foreach (long b in values)
+            {
+                long c = a ^ 0x55;
+                long d = b - 3;
+
+                for (int s = 0; s < 5; s++)
+                {
+                    Check("long", ComputeLong(a, b, c, d, s), ReferenceLong(a, b, c, d, s));
+                    Check("int", ComputeInt((int)a, (int)b, (int)c, (int)d, s),
+                          ReferenceInt((int)a, (int)b, (int)c, (int)d, s));
+                }
+
+                Check("calls", ComputeAcrossCalls(a, b, c, d), ReferenceAcrossCalls(a, b, c, d));
+            }
+        }
+
+        if (s_failures != 0)
+        {
+            Console.WriteLine($"FAILED: {s_failures} failures");
+            return -1;
+        }
+
+        Console.WriteLine("PASSED");
+        return 100;
+    }
+}
@@ -0,0 +1,123 @@
+// Licensed to the .NET Foundation under one or more agreements.
+// The .NET Foundation licenses this file to you under the MIT license.
+// See the LICENSE file in the project root for more information.
+
+// Struct promotion of fields that are nested single-field wrapper structs.
+// The wrappers are retyped to their innermost scalar, so both the scalar
+// accesses and the whole-wrapper copies below must see the same values.
+
+using System;
+using System.Runtime.CompilerServices;
+
+struct Id
+{
+    public int Value;
+}
+
+struct Handle
+{
+    public Id Id;
+}
+
+struct Entry
+{
+    public Handle Handle;
+    public long Stamp;
+}
+
+struct Ptr
+{
+    public object Target;
+}
+
+struct Ref
+{
+    public Ptr Ptr;
+}
+
+struct Pair
+{
+    public Ref First;
+    public Ref Second;
+}
+
+class NestedWrapper
+{
+    [MethodImpl(MethodImplOptions.NoInlining)]
+    static Handle MakeHandle(int value)
+    {
+        Handle h;
+        h.Id.Value = value;
+        return h;
+    }
+
+    [MethodImpl(MethodImplOptions.NoInlining)]
+    static int Sum(int n)
+    {
+        Entry e = default(Entry);
+        int sum = 0;
+
+        for (int i = 0; i < n; i++)
+        {
+            e.Handle.Id.Value += i;
+            e.Stamp++;
+            sum += e.Handle.Id.Value;
+        }
+
+        return sum + (int)e.Stamp;
+    }
+
+    [MethodImpl(MethodImplOptions.NoInlining)]
+    static int CopyWrappers(int value)
+    {
+        Entry e = default(Entry);
+        e.Handle = MakeHandle(value);
+
+        Id id = e.Handle.Id;
+        Handle h = e.Handle;
+        h.Id.Value++;
+        e.Handle.Id = h.Id;
+
+        return id.Value + e.Handle.Id.Value;
+    }
+
+    [MethodImpl(MethodImplOptions.NoInlining)]
+    static bool Swap(object a, object b)
+    {
+        Pair p;
+        p.First.Ptr.Target = a;
+        p.Second.Ptr.Target = b;
+
+        Ref tmp = p.First;
+        p.First = p.Second;
+        p.Second.Ptr = tmp.Ptr;
+
+        GC.Collect();
+
+        return (p.First.Ptr.Target == b) && (p.Second.Ptr.Target == a);
+    }
+
+    static int Main()
+    {
+        if (Sum(10) != 175)
+        {
+            Console.WriteLine("FAILED: Sum");
+            return -1;
+        }
+
+        if (CopyWrappers(20) != 41)
+        {
+            Console.WriteLine("FAILED: CopyWrappers");
+            return -1;
+        }
+
+        if (!Swap(new object(), "b"))
+        {
+            Console.WriteLine("FAILED: Swap");
+            return -1;
+        }
+
+        Console.WriteLine("PASSED");
+        return 100;
+    }
+}
@@ -464,6 +464,39 @@ class TestCases
         return x;
     }
 
+    static int s_failures;
+
+    public static int TwoIdenticalThrowHelpersSameStatements(int x)
+    {
+        if (x == 0)
+        {
+            s_failures++;
+            Throw();
+        }
+        else if (x == 1)
+        {
+            s_failures++;
+            Throw();
+        }
+
+        return x;
+    }
+
+    public static int TwoIdenticalThrowHelpersDifferentStatements(int x)
+    {
+        if (x == 0)
+        {
+            s_failures++;
+            Throw();
+        }
+        else if (x == 1)
+        {
+            s_failures--;
+            Throw();
+        }
+
+        return x;
+    }
 
     static int testNumber = 0;
     static bool failed = false;
@@ -506,6 +539,40 @@ class TestCases
         }
     }
 
+    // Run f on each throwing input and check that the statements ahead of the
+    // throw ran and had the expected effect on s_failures, so that blocks
+    // which differ only in those statements are not merged.
+    static void TryStatements(Func<int, int> f, int delta0, int delta1)
+    {
+        Try(f);
+
+        TryThrowingStatement(f, 0, delta0);
+        TryThrowingStatement(f, 1, delta1);
+    }
+
+    static void TryThrowingStatement(Func<int, int> f, int x, int delta)
+    {
+        testNumber++;
+
+        int before = s_failures;
+        bool threw = false;
+
+        try
+        {
+            f(x);
+        }
+        catch (TestException)
+        {
+            threw = true;
+        }
+
+        if (!threw || (s_failures - before != delta))
+        {
+            Console.WriteLine($"Test {testNumber} failed\n");
+            failed = true;
+        }
+    }
+
     public static int Main()
     {
         Try(OneThrowHelper);
@@ -534,6 +601,8 @@ class TestCases
         Try(ThreeIdenticalThrowHelpers_IfThreeTail);
         Try(TwoIdenticalThrowHelpersSameArgTrees);
         Try(TwoIdenticalThrowHelpersDifferentArgTrees);
+        TryStatements(TwoIdenticalThrowHelpersSameStatements, 1, 1);
+        TryStatements(TwoIdenticalThrowHelpersDifferentStatements, 1, -1);
 
         Console.WriteLine(failed ? "" : $"All {testNumber} tests passed");
         return failed ? -1 : 100;
@@ -0,0 +1,108 @@
+// Licensed to the .NET Foundation under one or more agreements.
+// The .NET Foundation licenses this file to you under the MIT license.
+// See the LICENSE file in the project root for more information.
+
+using System;
+using System.Runtime.CompilerServices;
+
+// Interface call sites that see a few receiver types get a chain of
+// dispatch stubs, and go to the resolve stub once they see more. Make
+// sure each receiver still reaches its own implementation as a call
+// site moves through those states.
+
+internal interface IValue
+{
+    int Value();
+}
+
+internal class V1 : IValue { public int Value() { return 1; } }
+internal class V2 : IValue { public int Value() { return 2; } }
+internal class V3 : IValue { public int Value() { return 3; } }
+internal class V4 : IValue { public int Value() { return 4; } }
+internal class V5 : IValue { public int Value() { return 5; } }
+internal class V6 : IValue { public int Value() { return 6; } }
+
+internal class Program
+{
+    private const int Iterations = 1000;
+
+    private static readonly IValue[] s_all = new IValue[] { new V1(), new V2(), new V3(), new V4(), new V5(), new V6() };
+
+    [MethodImpl(MethodImplOptions.NoInlining)]
+    private static int Sum(IValue[] values)
+    {
+        int sum = 0;
+        for (int i = 0; i < values.Length; i++)
+        {
+            sum += values[i].Value();
+        }
+        return sum;
+    }
+
+    [MethodImpl(MethodImplOptions.NoInlining)]
+    private static int Call(IValue value)
+    {
+        return value.Value();
+    }
+
+    private static bool Check(int typeCount)
+    {
+        IValue[] values = new IValue[typeCount];
+        Array.Copy(s_all, values, typeCount);
+        int expected = typeCount * (typeCount + 1) / 2;
+
+        for (int i = 0; i < Iterations; i++)
+        {
+            int sum = Sum(values);
+            if (sum != expected)
+            {
+                Console.WriteLine("FAILED: {0} types, expected {1}, got {2}", typeCount, expected, sum);
+                return false;
+            }
+        }
+
+        return true;
+    }
+
+    private static int Main()
+    {
+        bool passed = true;
+
+        // The same call site sees a growing number of types
+        for (int typeCount = 1; typeCount <= s_all.Length; typeCount++)
+        {
+            passed &= Check(typeCount);
+        }
+
+        // A second call site that alternates between two types, then sees all of them
+        for (int i = 0; i < Iterations; i++)
+        {
+            IValue value = s_all[i % 2];
+            if (Call(value) != (i % 2) + 1)
+            {
+                Console.WriteLine("FAILED: two types, iteration {0}", i);
+                passed = false;
+                break;
+            }
+        }
+
+        for (int i = 0; i < Iterations; i++)
+        {
+            IValue value = s_all[i % s_all.Length];
+            if (Call(value) != (i % s_all.Length) + 1)
+            {
+                Console.WriteLine("FAILED: all types, iteration {0}", i);
+                passed = false;
+                break;
+            }
+        }
+
+        if (passed)
+        {
+            Console.WriteLine("PASSED");
+            return 100;
+        }
+
+        return 101;
+    }
+}
@@ -0,0 +1,101 @@
+// Licensed to the .NET Foundation under one or more agreements.
+// The .NET Foundation licenses this file to you under the MIT license.
+// See the LICENSE file in the project root for more information.
+
+using System;
+using System.Runtime.CompilerServices;
+
+// The runtime resolves the type of a typed catch clause the first time it is examined and caches it
+// in the method's EH clause. Run each catch several times so that later dispatches go through the
+// cached type, and check that it still only catches what it should.
+class CachedCatchType
+{
+    class MyException : Exception
+    {
+    }
+
+    class DerivedException : MyException
+    {
+    }
+
+    static int s_failures;
+
+    [MethodImpl(MethodImplOptions.NoInlining)]
+    static void Throw(Exception e)
+    {
+        throw e;
+    }
+
+    [MethodImpl(MethodImplOptions.NoInlining)]
+    static string CatchTyped(Exception e)
+    {
+        try
+        {
+            Throw(e);
+        }
+        catch (MyException)
+        {
+            return "MyException";
+        }
+
+        return "none";
+    }
+
+    [MethodImpl(MethodImplOptions.NoInlining)]
+    static string CatchTypedOrOther(Exception e)
+    {
+        try
+        {
+            return CatchTyped(e);
+        }
+        catch (InvalidOperationException)
+        {
+            return "InvalidOperationException";
+        }
+    }
+
+    [MethodImpl(MethodImplOptions.NoInlining)]
+    static string CatchAll(Exception e)
+    {
+        try
+        {
+            Throw(e);
+        }
+        catch
+        {
+            return "all";
+        }
+
+        return "none";
+    }
+
+    static void Check(string actual, string expected, string what)
+    {
+        if (actual != expected)
+        {
+            Console.WriteLine($"{what}: expected {expected}, got {actual}");
+            s_failures++;
+        }
+    }
+
+    static int Main()
+    {
+        for (int i = 0; i < 3; i++)
+        {
+            Check(CatchTypedOrOther(new MyException()), "MyException", $"MyException, pass {i}");
+            Check(CatchTypedOrOther(new DerivedException()), "MyException", $"DerivedException, pass {i}");
+            Check(CatchTypedOrOther(new InvalidOperationException()), "InvalidOperationException", $"InvalidOperationException, pass {i}");
+            Check(CatchAll(new MyException()), "all", $"catch all MyException, pass {i}");
+            Check(CatchAll(new InvalidOperationException()), "all", $"catch all InvalidOperationException, pass {i}");
+        }
+
+        if (s_failures != 0)
+        {
+            Console.WriteLine("FAILED");
+            return 101;
+        }
+
+        Console.WriteLine("PASSED");
+        return 100;
+    }
+}
@@ -0,0 +1,98 @@
+// Licensed to the .NET Foundation under one or more agreements.
+// The .NET Foundation licenses this file to you under the MIT license.
+// See the LICENSE file in the project root for more information.
+
+using System;
+using System.Diagnostics;
+using System.Threading;
+
+// Smoke test for contending on a Monitor with short and with long hold times, which drives the lock's
+// spin count down and back up again. Checks that every increment made under the lock is observed. The
+// thread count and the total time spent holding the lock are bounded so that the test stays short on
+// machines with many processors.
+class MonitorContention
+{
+    const int MaxThreadCount = 8;
+    const int ShortHoldsPerThread = 20000;
+    const int TotalLongHolds = 200;
+    const double LongHoldMs = 1.0;
+
+    static readonly object s_lock = new object();
+    static long s_counter;
+
+    static int s_failed;
+
+    static void Hold(double holdMs)
+    {
+        if (holdMs == 0)
+        {
+            Thread.SpinWait(1);
+            return;
+        }
+
+        long end = Stopwatch.GetTimestamp() + (long)(holdMs * Stopwatch.Frequency / 1000);
+        while (Stopwatch.GetTimestamp() < end)
+        {
+            Thread.SpinWait(10);
+        }
+    }
+
+    static void Contend(int threadCount, double holdMs, int iterationsPerThread, string name)
+    {
+        s_counter = 0;
+
+        var threads = new Thread[threadCount];
+        var start = new ManualResetEvent(false);
+
+        for (int i = 0; i < threadCount; i++)
+        {
+            threads[i] = new Thread(() =>
+            {
+                start.WaitOne();
+                for (int j = 0; j < iterationsPerThread; j++)
+                {
+                    lock (s_lock)
+                    {
+                        s_counter++;
+                        Hold(holdMs);
+                    }
+                }
+            });
+            threads[i].IsBackground = true;
+            threads[i].Start();
+        }
+
+        Stopwatch sw = Stopwatch.StartNew();
+        start.Set();
+        foreach (Thread t in threads)
+        {
+            t.Join();
+        }
+        sw.Stop();
+
+        long expected = (long)threadCount * iterationsPerThread;
+        Console.WriteLine($"{name}: {threadCount} threads, {expected} acquisitions in {sw.ElapsedMilliseconds}ms");
+
+        if (s_counter != expected)
+        {
+            Console.WriteLine($"{name}: expected {expected} acquisitions, observed {s_counter}");
+            s_failed++;
+        }
+    }
+
+    static int Main()
+    {
+        int threadCount = Math.Max(2, Math.Min(MaxThreadCount, Environment.ProcessorCount));
+
+        // Short holds, where spinning is expected to acquire the lock
+        Contend(threadCount, 0, ShortHoldsPerThread, "Short hold");
+
+        // Long holds, where spinners are expected to give up and wait
+        Contend(threadCount, LongHoldMs, Math.Max(1, TotalLongHolds / threadCount), "Long hold");
+
+        // Short holds again on the same lock, where spinning is expected to recover
+        Contend(threadCount, 0, ShortHoldsPerThread, "Short hold after long hold");
+
+        return s_failed == 0 ? 100 : 101;
+    }
+}
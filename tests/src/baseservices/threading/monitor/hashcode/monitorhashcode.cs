@@ -0,0 +1,189 @@
+// Licensed to the .NET Foundation under one or more agreements.
+// The .NET Foundation licenses this file to you under the MIT license.
+// See the LICENSE file in the project root for more information.
+
+using System;
+using System.Runtime.CompilerServices;
+using System.Threading;
+
+// An object that is both hashed and locked needs a syncblock to hold its hash code. Once the lock is
+// released, the GC may free that syncblock and move the hash code back into the object header. Checks
+// that the identity hash code of an object stays the same across these transitions, and that the other
+// bits in the header are kept when the hash code is moved back.
+class MonitorHashCode
+{
+    static int s_failed;
+
+    static void Check(string name, object obj, int expected)
+    {
+        int actual = RuntimeHelpers.GetHashCode(obj);
+        if (actual != expected)
+        {
+            Console.WriteLine($"{name}: hash code changed from 0x{expected:X} to 0x{actual:X}");
+            s_failed++;
+        }
+    }
+
+    static void Collect()
+    {
+        // The syncblock is only freed once the GC has found it idle, which may take more than one collection
+        for (int i = 0; i < 3; i++)
+        {
+            GC.Collect();
+            GC.WaitForPendingFinalizers();
+        }
+    }
+
+    // Hash, then lock, so that the hash code moves from the header into a syncblock
+    static void HashThenLock(string name, object obj)
+    {
+        int hash = RuntimeHelpers.GetHashCode(obj);
+
+        lock (obj)
+        {
+            Check(name + " (locked)", obj, hash);
+        }
+
+        Collect();
+        Check(name + " (after GC)", obj, hash);
+
+        lock (obj)
+        {
+            Check(name + " (locked again)", obj, hash);
+        }
+        Check(name + " (unlocked again)", obj, hash);
+    }
+
+    // Lock, then hash, so that the hash code is generated into the syncblock
+    static void LockThenHash(string name, object obj)
+    {
+        int hash;
+        lock (obj)
+        {
+            hash = RuntimeHelpers.GetHashCode(obj);
+        }
+
+        Collect();
+
+        lock (obj)
+        {
+            Check(name + " (locked after GC)", obj, hash);
+        }
+
+        Collect();
+        Check(name + " (after second GC)", obj, hash);
+    }
+
+    // Hold the lock across GCs while the object has a hash code, so the syncblock is not idle and must be kept
+    static void LockHeldAcrossGC(string name, object obj)
+    {
+        lock (obj)
+        {
+            int hash = RuntimeHelpers.GetHashCode(obj);
+
+            Collect();
+            Check(name + " (held across GC)", obj, hash);
+
+            if (!Monitor.IsEntered(obj))
+            {
+                Console.WriteLine($"{name}: lock was lost across GC");
+                s_failed++;
+            }
+
+            // The lock must still exclude other threads
+            bool enteredElsewhere = true;
+            var t = new Thread(() => enteredElsewhere = Monitor.TryEnter(obj));
+            t.Start();
+            t.Join();
+            if (enteredElsewhere)
+            {
+                Console.WriteLine($"{name}: another thread entered the held lock");
+                s_failed++;
+            }
+
+            Collect();
+            Check(name + " (still held)", obj, hash);
+        }
+    }
+
+    static void RunAll(string name, Func<object> create)
+    {
+        HashThenLock(name + ": hash, lock", create());
+        LockThenHash(name + ": lock, hash", create());
+        LockHeldAcrossGC(name + ": hash while locked", create());
+
+        object obj = create();
+        for (int i = 0; i < 3; i++)
+        {
+            HashThenLock(name + ": repeated cycle " + i, obj);
+        }
+    }
+
+    class Finalizable
+    {
+        public static int s_finalized;
+
+        ~Finalizable()
+        {
+            Interlocked.Increment(ref s_finalized);
+        }
+    }
+
+    // GC.SuppressFinalize records that the finalizer has run in a header bit, which must survive
+    // the hash code being moved back into the header.
+    [MethodImpl(MethodImplOptions.NoInlining)]
+    static void HashAndLockSuppressedFinalizable()
+    {
+        var obj = new Finalizable();
+        GC.SuppressFinalize(obj);
+        HashThenLock("Suppressed finalizer", obj);
+        LockThenHash("Suppressed finalizer", obj);
+    }
+
+    static void CheckFinalizerBitKept()
+    {
+        HashAndLockSuppressedFinalizable();
+        Collect();
+
+        if (Finalizable.s_finalized != 0)
+        {
+            Console.WriteLine("Suppressed finalizer: finalizer ran after the hash code was moved back to the header");
+            s_failed++;
+        }
+    }
+
+    // Strings share the header layout with other objects, so their hash code and contents must come
+    // through the same transitions unchanged.
+    static void CheckString()
+    {
+        string s = new string(new[] { 'h', '\u00E9', 'l', 'l', '\u00F6', '\u4E16' });
+        string copy = new string(s.ToCharArray());
+
+        RunAll("String", () => new string(s.ToCharArray()));
+
+        int hash = RuntimeHelpers.GetHashCode(s);
+        lock (s)
+        {
+        }
+        Collect();
+        Check("String", s, hash);
+
+        if (!string.Equals(s, copy, StringComparison.Ordinal) ||
+            string.Compare(s, copy, StringComparison.OrdinalIgnoreCase) != 0 ||
+            string.Compare(s, copy, StringComparison.CurrentCulture) != 0 ||
+            s.GetHashCode() != copy.GetHashCode())
+        {
+            Console.WriteLine("String: contents or comparisons changed after the hash code was moved back to the header");
+            s_failed++;
+        }
+    }
+
+    static int Main()
+    {
+        RunAll("Object", () => new object());
+        CheckFinalizerBitKept();
+        CheckString();
+
+        return s_failed == 0 ? 100 : 101;
+    }
+}